@@ -0,0 +1,145 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterParticleTrigger.h"
+#include "ShooterParticleTriggerManager.h"
+#include "ShooterPawnGrid.h"
+
+FShooterParticleTriggerManager::FShooterParticleTriggerManager()
+	: CheckInterval(1.0f)
+	, TrailDrawDistance(20000.0f)
+	, Cursor(0)
+	, PendingChecks(0.0f)
+{
+}
+
+void FShooterParticleTriggerManager::Register(AShooterParticleTrigger* Trigger)
+{
+	check(Trigger);
+
+	if (Triggers.Contains(Trigger))
+		return;
+
+	Triggers.Add(Trigger);
+	Locations.Add(Trigger->GetActorLocation());
+	CheckRadii.Add(Trigger->CheckRadius);
+}
+
+void FShooterParticleTriggerManager::Unregister(AShooterParticleTrigger* Trigger)
+{
+	const int32 Index = Triggers.Find(Trigger);
+
+	if (Index != INDEX_NONE)
+	{
+		Triggers.RemoveAtSwap(Index, 1, false);
+		Locations.RemoveAtSwap(Index, 1, false);
+		CheckRadii.RemoveAtSwap(Index, 1, false);
+	}
+}
+
+void FShooterParticleTriggerManager::Empty()
+{
+	Triggers.Empty();
+	Locations.Empty();
+	CheckRadii.Empty();
+	TrailHeads.Empty();
+	TrailStarts.Empty();
+	TrailDirections.Empty();
+	TrailStartTimes.Empty();
+	TrailDurations.Empty();
+	TrailCenters.Empty();
+	TrailRadii.Empty();
+	TrailVisible.Empty();
+	Cursor		  = 0;
+	PendingChecks = 0.0f;
+}
+
+void FShooterParticleTriggerManager::AddTrail(const FShooterPoolHandle& Head, const AStaticMeshActor* Mesh, const FVector& Start, const FVector& Direction, float StartTime, float Duration)
+{
+	check(Head.IsSet() && Mesh);
+
+	TrailHeads.Add(Head);
+	TrailStarts.Add(Start);
+	TrailDirections.Add(Direction);
+	TrailStartTimes.Add(StartTime);
+	TrailDurations.Add(FMath::Max(Duration, KINDA_SMALL_NUMBER));
+	TrailCenters.Add(Start + Direction * 0.5f);
+	TrailRadii.Add(Direction.Size() * 0.5f + Mesh->GetStaticMeshComponent()->Bounds.SphereRadius);
+	TrailVisible.Add(true);
+}
+
+void FShooterParticleTriggerManager::Tick(float DeltaSeconds, const FShooterPawnGrid& PawnGrid)
+{
+	const int32 Count = Triggers.Num();
+
+	if (Count > 0)
+	{
+		// Share of the pass that belongs to this frame. A long frame checks more, never more than one full pass.
+		PendingChecks	   = FMath::Min(PendingChecks + Count * DeltaSeconds / FMath::Max(CheckInterval, KINDA_SMALL_NUMBER), float(Count));
+		int32 CheckCount   = FMath::FloorToInt(PendingChecks);
+		PendingChecks	  -= CheckCount;
+
+		for (; CheckCount > 0; CheckCount--)
+		{
+			if (Cursor >= Triggers.Num())
+				Cursor = 0;
+
+			const int32 Index = Cursor++;
+
+			if (PawnGrid.AnyInRadius(Locations[Index], CheckRadii[Index]))
+			{
+				Triggers[Index]->OnPlayerWithinDistance();
+			}
+		}
+	}
+}
+
+void FShooterParticleTriggerManager::UpdateTrails(float Now, bool bHasView, const FVector& ViewLocation, const FVector& ViewDirection, TFunctionRef<AStaticMeshActor*(const FShooterPoolHandle&)> ResolveHead, TArray<FShooterPoolHandle>& OutFinished)
+{
+	// Backwards, a trail that finished is swap-removed
+	for (int32 Index = TrailHeads.Num() - 1; Index >= 0; Index--)
+	{
+		AStaticMeshActor* Mesh = ResolveHead(TrailHeads[Index]);
+		const float Alpha	   = (Now - TrailStartTimes[Index]) / TrailDurations[Index];
+
+		// Done, or the head's slot was recycled and is no longer ours to move or hand back
+		if (!Mesh || Alpha >= 1.0f)
+		{
+			if (Mesh)
+			{
+				OutFinished.Add(TrailHeads[Index]);
+			}
+
+			TrailHeads.RemoveAtSwap(Index, 1, false);
+			TrailStarts.RemoveAtSwap(Index, 1, false);
+			TrailDirections.RemoveAtSwap(Index, 1, false);
+			TrailStartTimes.RemoveAtSwap(Index, 1, false);
+			TrailDurations.RemoveAtSwap(Index, 1, false);
+			TrailCenters.RemoveAtSwap(Index, 1, false);
+			TrailRadii.RemoveAtSwap(Index, 1, false);
+			TrailVisible.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		// On screen when within draw distance and not entirely behind the view
+		const FVector ToCenter = TrailCenters[Index] - ViewLocation;
+		const float Radius	   = TrailRadii[Index];
+		const bool bVisible	   = bHasView &&
+								 ToCenter.SizeSquared() <= FMath::Square(TrailDrawDistance + Radius) &&
+								 FVector::DotProduct(ToCenter, ViewDirection) >= -Radius;
+
+		if (bVisible != (TrailVisible[Index] != 0))
+		{
+			TrailVisible[Index] = bVisible;
+			Mesh->SetActorHiddenInGame(!bVisible);
+		}
+
+		if (!bVisible)
+			continue;
+
+		// Closed form, where the head is at Now no matter how many frames were skipped
+		const float LocationBias = FMath::InterpEaseOut(0.0f, 1.0f, FMath::Max(Alpha, 0.0f), 1.2f);
+
+		Mesh->SetActorLocation(TrailStarts[Index] + TrailDirections[Index] * LocationBias);
+	}
+}
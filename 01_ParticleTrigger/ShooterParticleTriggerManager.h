@@ -0,0 +1,88 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterPool.h"
+
+class AShooterParticleTrigger;
+class AStaticMeshActor;
+class FShooterPawnGrid;
+
+/**
+* Evaluates every AShooterParticleTrigger of the world, owned by AShooterGameState.
+*
+* Triggers register in BeginPlay and unregister in EndPlay, none of them ticks or arms a timer.
+* Trigger data the check needs is copied into flat arrays (SoA) on register. A full pass over all
+* triggers takes CheckInterval seconds and is spread across the frames of that interval, so each
+* frame only checks its share against the pawn grid.
+*
+* Trail heads are meshes from the game state's mesh pool, the triggers do not own one. A running
+* trail only keeps its head's pool handle and where and when it started, UpdateTrails() places
+* every on screen head where its trail is at Now in one pass. Heads out of draw distance or behind
+* the view are hidden and not moved at all, they are back in the right place the first frame they
+* are on screen again. A head whose slot was recycled no longer resolves and its trail is dropped.
+*/
+class FShooterParticleTriggerManager
+{
+public:
+	FShooterParticleTriggerManager();
+
+	void Register(AShooterParticleTrigger* Trigger);
+	void Unregister(AShooterParticleTrigger* Trigger);
+	void Empty();
+
+	/**
+	* Run a trail head from Start to Start + Direction over Duration seconds.
+	* @param Head - pooled mesh with no lifetime, handed back through UpdateTrails() when the trail is done.
+	* @param Mesh - the mesh Head resolves to now, for the trail's bounds.
+	*/
+	void AddTrail(const FShooterPoolHandle& Head, const AStaticMeshActor* Mesh, const FVector& Start, const FVector& Direction, float StartTime, float Duration);
+
+	/** Check this frame's slice of triggers against PawnGrid. */
+	void Tick(float DeltaSeconds, const FShooterPawnGrid& PawnGrid);
+
+	/**
+	* Place the heads of all running trails where they are at Now.
+	* @param bHasView - false when nothing looks at the world (server), every head stays hidden.
+	* @param ResolveHead - mesh a head handle still refers to, NULL once its slot was given to another use.
+	* @param OutFinished - heads of the trails that ended, the caller gives them back to the pool.
+	*/
+	void UpdateTrails(float Now, bool bHasView, const FVector& ViewLocation, const FVector& ViewDirection, TFunctionRef<AStaticMeshActor*(const FShooterPoolHandle&)> ResolveHead, TArray<FShooterPoolHandle>& OutFinished);
+
+	inline int32 NumTrails() const
+	{
+		return TrailHeads.Num();
+	}
+
+	inline int32 Num() const
+	{
+		return Triggers.Num();
+	}
+
+	/** How long a full pass over all triggers takes, the interval each trigger used to have its own timer for. */
+	float CheckInterval;
+
+	/** Trails further away than this from the view are hidden */
+	float TrailDrawDistance;
+
+private:
+	TArray<AShooterParticleTrigger*> Triggers;
+	TArray<FVector>					 Locations;
+	TArray<float>					 CheckRadii;
+
+	TArray<FShooterPoolHandle>		 TrailHeads;
+	TArray<FVector>					 TrailStarts;
+	TArray<FVector>					 TrailDirections;
+	TArray<float>					 TrailStartTimes;
+	TArray<float>					 TrailDurations;
+	/** Bounding sphere of the whole path, head included */
+	TArray<FVector>					 TrailCenters;
+	TArray<float>					 TrailRadii;
+	TArray<uint8>					 TrailVisible;
+
+	/** Next trigger to check */
+	int32 Cursor;
+
+	/** Fraction of a trigger carried over to the next frame's slice */
+	float PendingChecks;
+};
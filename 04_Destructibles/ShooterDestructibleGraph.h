@@ -0,0 +1,125 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* Chain destruction neighbours of every destructible in the level.
+*
+* Destructibles never move, so "who is within whose CheckRadius" is computed once and stored as
+* adjacency arrays (NeighborOffsets / Neighbors, indexed by node). An edge A -> B exists when B
+* is within A's CheckRadius on the XY plane and B has bDamageByDestructible set.
+*/
+class FShooterDestructibleGraph
+{
+public:
+	void Build(const TArray<AShooterDestructible*>& Destructibles)
+	{
+		Empty();
+
+		const int32 Count = Destructibles.Num();
+
+		Nodes.Reserve(Count);
+		NeighborOffsets.Reserve(Count + 1);
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			NodeIndices.Add(Destructibles[Index], Nodes.Add(Destructibles[Index]));
+		}
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			AShooterDestructible* Instigator = Nodes[Index];
+
+			NeighborOffsets.Add(Neighbors.Num());
+
+			const FVector InstigatorLocation = Instigator->GetActorLocation();
+			const float CheckRadiusSq		 = Instigator->CheckRadius * Instigator->CheckRadius;
+
+			for (int32 Other = 0; Other < Count; Other++)
+			{
+				AShooterDestructible* Destructible = Nodes[Other];
+
+				if (Other == Index || !Destructible->bDamageByDestructible)
+					continue;
+
+				if (FVector::DistSquaredXY(Destructible->GetActorLocation(), InstigatorLocation) < CheckRadiusSq)
+				{
+					Neighbors.Add(Other);
+				}
+			}
+		}
+		NeighborOffsets.Add(Neighbors.Num());
+	}
+
+	void Empty()
+	{
+		Nodes.Reset();
+		NodeIndices.Reset();
+		NeighborOffsets.Reset();
+		Neighbors.Reset();
+	}
+
+	/** Graph was built from exactly Destructibles, in the same order. */
+	bool IsBuiltFor(const TArray<AShooterDestructible*>& Destructibles) const
+	{
+		const int32 Count = Destructibles.Num();
+
+		if (Nodes.Num() != Count)
+			return false;
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			if (Nodes[Index] != Destructibles[Index])
+				return false;
+		}
+		return true;
+	}
+
+	inline int32 Num() const
+	{
+		return Nodes.Num();
+	}
+
+	inline int32 NumEdges() const
+	{
+		return Neighbors.Num();
+	}
+
+	inline AShooterDestructible* GetNode(int32 Node) const
+	{
+		return Nodes[Node];
+	}
+
+	/** @return node of Destructible or INDEX_NONE. */
+	inline int32 Find(const AShooterDestructible* Destructible) const
+	{
+		const int32* Node = NodeIndices.Find(Destructible);
+		return Node ? *Node : INDEX_NONE;
+	}
+
+	/** Call Func(int32 NeighborNode) for every destructible Node damages when it is destroyed. */
+	template<typename FuncType>
+	void ForEachNeighbor(int32 Node, FuncType Func) const
+	{
+		const int32 End = NeighborOffsets[Node + 1];
+
+		for (int32 Edge = NeighborOffsets[Node]; Edge < End; Edge++)
+		{
+			Func(Neighbors[Edge]);
+		}
+	}
+
+private:
+	TArray<AShooterDestructible*>			  Nodes;
+	TMap<const AShooterDestructible*, int32>  NodeIndices;
+	/** Node's neighbours are Neighbors[NeighborOffsets[Node], NeighborOffsets[Node + 1]) */
+	TArray<int32>							  NeighborOffsets;
+	TArray<int32>							  Neighbors;
+};
+
+/** Destructibles that take their chain damage at the same time. */
+struct FShooterDestructibleWave
+{
+	float		  DueTime;
+	TArray<int32> Nodes;
+};
@@ -1,11 +1,48 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "ShooterGame.h"
-#include "FlipBookData.h"
-
-AFlipBookData::AFlipBookData(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
-{
-}
-
-
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ShooterGame.h"
+#include "FlipBookData.h"
+
+namespace FlipBookDataFPS
+{
+	struct FEntry
+	{
+		EFlippBookSpeed Speed;
+		float			FPS;
+	};
+
+	static constexpr FEntry Table[] =
+	{
+		{ EFlippBookSpeed::FPS_8,	8.0f },
+		{ EFlippBookSpeed::FPS_16,	16.0f },
+		{ EFlippBookSpeed::FPS_24,	24.0f },
+		{ EFlippBookSpeed::FPS_30,	30.0f },
+		{ EFlippBookSpeed::FPS_38,	38.0f },
+		{ EFlippBookSpeed::FPS_48,	48.0f },
+		{ EFlippBookSpeed::FPS_52,	52.0f },
+		{ EFlippBookSpeed::FPS_60,	60.0f },
+		{ EFlippBookSpeed::FPS_72,	72.0f },
+		{ EFlippBookSpeed::FPS_86,	86.0f },
+		{ EFlippBookSpeed::FPS_90,	90.0f },
+		{ EFlippBookSpeed::FPS_120,	120.0f },
+	};
+
+	static constexpr float DefaultFPS = 30.0f;
+}
+
+AFlipBookData::AFlipBookData(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+float AFlipBookData::GetFPS(EFlippBookSpeed Speed)
+{
+	for (const FlipBookDataFPS::FEntry& Entry : FlipBookDataFPS::Table)
+	{
+		if (Entry.Speed == Speed)
+			return Entry.FPS;
+	}
+	return FlipBookDataFPS::DefaultFPS;
+}
+
+
@@ -1,29 +1,37 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "GameFramework/Actor.h"
-#include "FlipBookData.generated.h"
-
-UCLASS()
-class SHOOTERGAME_API AFlipBookData : public AActor
-{
-	GENERATED_UCLASS_BODY()
-	
-public:	
-	/** Speed for the flipbook animation */
-	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
-	EFlippBookSpeed FlipBookFPS;
-
-	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
-	TArray< UStaticMesh* > MeshArray;
-
-	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
-	FRotator RotationOffset;
-
-	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
-	bool bUseTint;
-
-	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
-	class UMaterialInstance* TintMaterial;
-};
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "FlipBookData.generated.h"
+
+UCLASS()
+class SHOOTERGAME_API AFlipBookData : public AActor
+{
+	GENERATED_UCLASS_BODY()
+	
+public:	
+	/** Speed for the flipbook animation */
+	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
+	EFlippBookSpeed FlipBookFPS;
+
+	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
+	TArray< UStaticMesh* > MeshArray;
+
+	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
+	FRotator RotationOffset;
+
+	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
+	bool bUseTint;
+
+	UPROPERTY(EditAnywhere, Category = "Flipbook Mesh")
+	class UMaterialInstance* TintMaterial;
+
+	/** Frames per second of FlipBookFPS */
+	inline float GetFPS() const
+	{
+		return GetFPS(FlipBookFPS);
+	}
+
+	static float GetFPS(EFlippBookSpeed Speed);
+};
@@ -0,0 +1,374 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterFlipbookRenderer.h"
+#include "ShooterEffectsFlipBook.h"
+#include "FlipBookData.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+/** Transform of the instances of the frames a flipbook does not show */
+static const FTransform CollapsedInstanceTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+
+FShooterFlipbookRenderer::FShooterFlipbookRenderer()
+	: Owner(NULL)
+	, bInitialized(false)
+	, bHeadless(true)
+{
+}
+
+void FShooterFlipbookRenderer::Init(AActor* InOwner)
+{
+	Empty();
+
+	Owner		 = InOwner;
+	bHeadless	 = !InOwner || IsRunningDedicatedServer() || !FApp::CanEverRender();
+	bInitialized = true;
+}
+
+void FShooterFlipbookRenderer::Empty()
+{
+	const int32 GroupCount = Groups.Num();
+
+	for (int32 GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++)
+	{
+		TArray<UInstancedStaticMeshComponent*>& Components = Groups[GroupIndex].Components;
+
+		for (int32 Frame = 0; Frame < Components.Num(); Frame++)
+		{
+			if (Components[Frame] && !Components[Frame]->IsPendingKill())
+			{
+				Components[Frame]->DestroyComponent();
+			}
+		}
+	}
+
+	Groups.Empty();
+	GroupIndices.Empty();
+
+	Slots.Empty();
+	Flipbooks.Empty();
+	SlotGroups.Empty();
+	SlotInstances.Empty();
+	FrameCounts.Empty();
+	FPSs.Empty();
+	SpawnTimes.Empty();
+	StartFrames.Empty();
+	Loops.Empty();
+	Frames.Empty();
+	ShownFrames.Empty();
+
+	Owner		 = NULL;
+	bInitialized = false;
+	bHeadless	 = true;
+}
+
+int32 FShooterFlipbookRenderer::FindOrAddGroup(const AFlipBookData* Data, int32 FrameCount)
+{
+	const int32* Found = GroupIndices.Find(Data);
+
+	if (Found)
+		return *Found;
+
+	const int32 GroupIndex		 = Groups.AddDefaulted();
+	FShooterFlipbookGroup& Group = Groups[GroupIndex];
+
+	Group.Data = Data;
+	Group.Components.SetNumZeroed(FrameCount);
+	Group.DirtyFrames.SetNumZeroed(FrameCount);
+
+	GroupIndices.Add(Data, GroupIndex);
+
+	if (bHeadless)
+		return GroupIndex;
+
+	for (int32 Frame = 0; Frame < FrameCount; Frame++)
+	{
+		UStaticMesh* Mesh = Data->MeshArray.IsValidIndex(Frame) ? Data->MeshArray[Frame] : NULL;
+
+		// Wrong timeframe set up in the data, the frame just shows nothing
+		if (!Mesh)
+			continue;
+
+		UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(Owner);
+
+		Component->SetStaticMesh(Mesh);
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Component->SetCollisionResponseToAllChannels(ECR_Ignore);
+		Component->SetCastShadow(false);
+		Component->bGenerateOverlapEvents = false;
+		Component->RegisterComponent();
+
+		Group.Components[Frame] = Component;
+	}
+	return GroupIndex;
+}
+
+int32 FShooterFlipbookRenderer::Add(const AFlipBookData* Data, int32 FrameCount, float FPS, bool bLoop, float SpawnTime, int32 StartFrame, AShooterEffectsFlipBook* Flipbook)
+{
+	check(bInitialized);
+	check(Data && FrameCount > 0);
+
+	int32 Handle = Slots.Pop();
+
+	if (Handle == INDEX_NONE)
+	{
+		Handle = Slots.AddSlot();
+		Slots.Pop();
+
+		Flipbooks.AddZeroed();
+		SlotGroups.AddZeroed();
+		SlotInstances.AddZeroed();
+		FrameCounts.AddZeroed();
+		FPSs.AddZeroed();
+		SpawnTimes.AddZeroed();
+		StartFrames.AddZeroed();
+		Loops.AddZeroed();
+		Frames.AddZeroed();
+		ShownFrames.AddZeroed();
+	}
+
+	const int32 GroupIndex		 = FindOrAddGroup(Data, FrameCount);
+	FShooterFlipbookGroup& Group = Groups[GroupIndex];
+
+	int32 Instance = Group.Instances.Pop();
+
+	// Group is at its high-water mark, one more instance in every frame
+	if (Instance == INDEX_NONE)
+	{
+		Instance = Group.Instances.AddSlot();
+		Group.Instances.Pop();
+
+		for (int32 Frame = 0; Frame < Group.Components.Num(); Frame++)
+		{
+			if (Group.Components[Frame])
+			{
+				Group.Components[Frame]->AddInstanceWorldSpace(CollapsedInstanceTransform);
+			}
+		}
+	}
+
+	Flipbooks[Handle]	  = Flipbook;
+	SlotGroups[Handle]	  = GroupIndex;
+	SlotInstances[Handle] = Instance;
+	FrameCounts[Handle]	  = bHeadless ? FrameCount : FMath::Min(FrameCount, Group.Components.Num());
+	FPSs[Handle]		  = FPS;
+	SpawnTimes[Handle]	  = SpawnTime;
+	StartFrames[Handle]	  = StartFrame;
+	Loops[Handle]		  = bLoop;
+	Frames[Handle]		  = SelectFrame(0.0f, FPS, FrameCounts[Handle], StartFrame, bLoop);
+	ShownFrames[Handle]	  = INDEX_NONE;
+
+	return Handle;
+}
+
+void FShooterFlipbookRenderer::Remove(int32 Handle)
+{
+	if (Handle < 0 || Handle >= Slots.Capacity() || Slots.IsFree(Handle))
+		return;
+
+	if (!bHeadless)
+	{
+		ShowFrame(Handle, INDEX_NONE, CollapsedInstanceTransform);
+	}
+
+	Groups[SlotGroups[Handle]].Instances.Push(SlotInstances[Handle]);
+
+	Flipbooks[Handle] = NULL;
+	Frames[Handle]	  = INDEX_NONE;
+
+	Slots.Push(Handle);
+}
+
+int32 FShooterFlipbookRenderer::SelectFrame(float Elapsed, float FPS, int32 FrameCount, int32 StartFrame, bool bLoop)
+{
+	if (FrameCount <= 0)
+		return INDEX_NONE;
+
+	const int32 Frame = StartFrame + FMath::FloorToInt(FMath::Max(Elapsed, 0.0f) * FPS);
+
+	if (bLoop)
+		return Frame % FrameCount;
+
+	return Frame < FrameCount ? Frame : INDEX_NONE;
+}
+
+void FShooterFlipbookRenderer::ShowFrame(int32 Handle, int32 Frame, const FTransform& Transform)
+{
+	FShooterFlipbookGroup& Group = Groups[SlotGroups[Handle]];
+	const int32 Instance		 = SlotInstances[Handle];
+	const int32 ShownFrame		 = ShownFrames[Handle];
+
+	if (ShownFrame != INDEX_NONE && ShownFrame != Frame && Group.Components[ShownFrame])
+	{
+		Group.Components[ShownFrame]->UpdateInstanceTransform(Instance, CollapsedInstanceTransform, true, false);
+		Group.DirtyFrames[ShownFrame] = true;
+	}
+
+	if (Frame != INDEX_NONE && Group.Components[Frame])
+	{
+		Group.Components[Frame]->UpdateInstanceTransform(Instance, Transform, true, false);
+		Group.DirtyFrames[Frame] = true;
+	}
+
+	ShownFrames[Handle] = Frame;
+}
+
+int32 FShooterFlipbookRenderer::Update(float Now, bool bHasView, const FQuat& ViewRotation)
+{
+	const int32 Capacity = Slots.Capacity();
+	int32 BillboardCount = 0;
+
+	for (int32 Handle = 0; Handle < Capacity; Handle++)
+	{
+		if (Slots.IsFree(Handle))
+			continue;
+
+		const int32 Frame = SelectFrame(Now - SpawnTimes[Handle], FPSs[Handle], FrameCounts[Handle], StartFrames[Handle], Loops[Handle] != 0);
+		Frames[Handle]	  = Frame;
+
+		if (bHeadless)
+			continue;
+
+		AShooterEffectsFlipBook* Flipbook = Flipbooks[Handle];
+
+		// Hidden by draw distance or by the flipbook itself, the instance stays collapsed
+		if (!Flipbook || Flipbook->bHidden || Frame == INDEX_NONE)
+		{
+			if (ShownFrames[Handle] != INDEX_NONE)
+			{
+				ShowFrame(Handle, INDEX_NONE, CollapsedInstanceTransform);
+			}
+			continue;
+		}
+
+		FTransform Transform = Flipbook->StaticMeshComp->GetComponentToWorld();
+
+		if (bHasView)
+		{
+			Transform.SetRotation(Flipbook->BillboardOffset * ViewRotation * Flipbook->BillboardSpin);
+			BillboardCount++;
+		}
+
+		ShowFrame(Handle, Frame, Transform);
+	}
+
+	if (bHeadless)
+		return 0;
+
+	// Instances were moved without touching the render state, one update per component that changed
+	const int32 GroupCount = Groups.Num();
+
+	for (int32 GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++)
+	{
+		FShooterFlipbookGroup& Group = Groups[GroupIndex];
+
+		for (int32 Frame = 0; Frame < Group.DirtyFrames.Num(); Frame++)
+		{
+			if (Group.DirtyFrames[Frame])
+			{
+				Group.Components[Frame]->MarkRenderStateDirty();
+				Group.DirtyFrames[Frame] = false;
+			}
+		}
+	}
+	return BillboardCount;
+}
+
+#if !UE_BUILD_SHIPPING
+void FShooterFlipbookRenderer::RunValidation()
+{
+	const float FPSList[]		 = { 8.0f, 16.0f, 24.0f, 30.0f, 38.0f, 60.0f, 120.0f };
+	const int32 FrameCountList[] = { 1, 4, 16, 33 };
+	const int32 Steps			 = 2000;
+
+	FRandomStream Random(0x5107);
+
+	// No owner, headless
+	FShooterFlipbookRenderer Renderer;
+	Renderer.Init(NULL);
+
+	const AFlipBookData* Data = GetDefault<AFlipBookData>();
+
+	TArray<int32> Handles;
+	TArray<int32> PreviousFrames;
+	TArray<uint8> Ended;
+
+	for (float FPS : FPSList)
+	{
+		for (int32 FrameCount : FrameCountList)
+		{
+			for (int32 Loop = 0; Loop < 2; Loop++)
+			{
+				const int32 StartFrame = Loop ? Random.RandHelper(FrameCount) : 0;
+
+				Handles.Add(Renderer.Add(Data, FrameCount, FPS, Loop != 0, 0.0f, StartFrame, NULL));
+				PreviousFrames.Add(StartFrame);
+				Ended.Add(false);
+			}
+		}
+	}
+
+	int32 Errors = 0;
+	float Now	 = 0.0f;
+	int32 Case	 = 0;
+
+	for (int32 Step = 0; Step < Steps; Step++)
+	{
+		const float DeltaSeconds = Random.FRandRange(0.004f, 0.05f);
+		Now += DeltaSeconds;
+
+		Renderer.Update(Now, false, FQuat::Identity);
+
+		Case = 0;
+
+		for (float FPS : FPSList)
+		{
+			for (int32 FrameCount : FrameCountList)
+			{
+				for (int32 Loop = 0; Loop < 2; Loop++, Case++)
+				{
+					const int32 Frame			= Renderer.GetFrame(Handles[Case]);
+					const int32 Previous		= PreviousFrames[Case];
+					const int32 MaxAdvance		= FMath::CeilToInt(DeltaSeconds * FPS);
+					const float EndTime			= FrameCount / FPS;
+					const bool bShouldHaveEnded = !Loop && Now >= EndTime + KINDA_SMALL_NUMBER;
+					const bool bMayHaveEnded	= !Loop && Now >= EndTime - KINDA_SMALL_NUMBER;
+
+					bool bValid = true;
+
+					if (Frame == INDEX_NONE)
+					{
+						// Only one-shots end, at the lifetime the pool gives them
+						bValid = bMayHaveEnded;
+					}
+					else
+					{
+						const int32 Advance = Loop ? (Frame - Previous + FrameCount) % FrameCount : Frame - Previous;
+
+						bValid = Frame >= 0 && Frame < FrameCount && !Ended[Case] && !bShouldHaveEnded &&
+								 Advance >= 0 && (Advance <= MaxAdvance || FrameCount <= MaxAdvance);
+					}
+
+					if (!bValid)
+					{
+						++Errors;
+						UE_LOG(LogShooter, Warning, TEXT("Flipbook validation: %.0f fps, %d frames, loop %d at %.4f s: frame %d after %d"), FPS, FrameCount, Loop, Now, Frame, Previous);
+					}
+
+					Ended[Case]			 = Frame == INDEX_NONE;
+					PreviousFrames[Case] = Frame == INDEX_NONE ? Previous : Frame;
+				}
+			}
+		}
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("Flipbook validation: %d flipbooks over %d frames (%.1f s), %d errors"), Handles.Num(), Steps, Now, Errors);
+}
+
+static FAutoConsoleCommand FlipbookValidationCommand(
+	TEXT("shooter.validateflipbookframes"),
+	TEXT("Run headless flipbooks at several fps, frame counts and loop settings over uneven frame times and log every wrong frame selection."),
+	FConsoleCommandDelegate::CreateStatic(&FShooterFlipbookRenderer::RunValidation)
+	);
+#endif // #if !UE_BUILD_SHIPPING
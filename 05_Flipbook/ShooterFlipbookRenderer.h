@@ -0,0 +1,129 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterPoolAllocator.h"
+
+class AFlipBookData;
+class AShooterEffectsFlipBook;
+class UInstancedStaticMeshComponent;
+
+/** Flipbooks of one AFlipBookData, drawn through one instanced component per frame mesh. */
+struct FShooterFlipbookGroup
+{
+	const AFlipBookData*					Data;
+	/** One per frame of Data->MeshArray, NULL for a missing mesh and for every frame when headless */
+	TArray<UInstancedStaticMeshComponent*>	Components;
+	/** Instance slots, an instance slot has the same index in every component of the group */
+	FShooterPoolFreeList					Instances;
+	/** Per frame, an instance of that frame's component moved this update */
+	TArray<uint8>							DirtyFrames;
+};
+
+/**
+* Draws the game state's flipbooks, owned by AShooterGameState.
+*
+* An activated flipbook is added with its AFlipBookData and keeps no mesh of its own. Flipbooks
+* of the same data are grouped, the group has one instanced component per frame mesh and every
+* flipbook of the group holds one instance slot in all of them. Only the instance of the flipbook's
+* current frame has its transform, the others are collapsed, so advancing a frame moves two
+* instance transforms and a group of any size costs one draw per frame mesh. The components are
+* plain instanced ones, every instance moves every frame and a hierarchical component would
+* rebuild its cluster tree each time.
+*
+* Frames are selected from the spawn time: StartFrame + floor((Now - SpawnTime) * FPS), wrapped for
+* looping flipbooks, INDEX_NONE once a one-shot ran past its last frame.
+*
+* Billboarding is done in the same pass. The view rotation is taken once per update and every shown
+* instance gets BillboardOffset * ViewRotation * BillboardSpin of its flipbook, written straight into
+* the instance transform, so the flipbook's own component is never rotated.
+*
+* Headless (dedicated server, no rendering, or Init() without an owner) the same frame selection
+* runs but no component is created or touched, which is what RunValidation() checks.
+*/
+class FShooterFlipbookRenderer
+{
+public:
+	FShooterFlipbookRenderer();
+
+	/** @param InOwner - actor the instanced components are created on, NULL for headless. */
+	void Init(AActor* InOwner);
+	void Empty();
+
+	inline bool IsInitialized() const
+	{
+		return bInitialized;
+	}
+
+	inline bool IsHeadless() const
+	{
+		return bHeadless;
+	}
+
+	/**
+	* Start drawing a flipbook.
+	* @param Flipbook - actor whose root component places the instance, NULL to only select frames.
+	* @return handle for Remove() / GetFrame().
+	*/
+	int32 Add(const AFlipBookData* Data, int32 FrameCount, float FPS, bool bLoop, float SpawnTime, int32 StartFrame, AShooterEffectsFlipBook* Flipbook);
+
+	void Remove(int32 Handle);
+
+	/**
+	* Select every flipbook's frame at Now and move its instance there, turned to the view.
+	* @param bHasView - false to keep the flipbooks' own rotation, no local player to face.
+	* @return number of instances billboarded.
+	*/
+	int32 Update(float Now, bool bHasView, const FQuat& ViewRotation);
+
+	/** @return frame Handle shows since the last Update(), INDEX_NONE when it ended. */
+	inline int32 GetFrame(int32 Handle) const
+	{
+		return Frames[Handle];
+	}
+
+	inline int32 Num() const
+	{
+		return Slots.NumUsed();
+	}
+
+	inline int32 NumGroups() const
+	{
+		return Groups.Num();
+	}
+
+	/** Frame of a flipbook Elapsed seconds after it spawned. */
+	static int32 SelectFrame(float Elapsed, float FPS, int32 FrameCount, int32 StartFrame, bool bLoop);
+
+#if !UE_BUILD_SHIPPING
+	/** Run headless flipbooks over uneven frame times and log every frame selection that breaks the rules. */
+	static void RunValidation();
+#endif // #if !UE_BUILD_SHIPPING
+
+private:
+	int32 FindOrAddGroup(const AFlipBookData* Data, int32 FrameCount);
+
+	/** Move Handle's instance from the frame it is shown in to Frame, INDEX_NONE to hide it. */
+	void ShowFrame(int32 Handle, int32 Frame, const FTransform& Transform);
+
+	AActor*								Owner;
+	TArray<FShooterFlipbookGroup>		Groups;
+	TMap<const AFlipBookData*, int32>	GroupIndices;
+
+	FShooterPoolFreeList				Slots;
+	TArray<AShooterEffectsFlipBook*>	Flipbooks;
+	TArray<int32>						SlotGroups;
+	TArray<int32>						SlotInstances;
+	TArray<int32>						FrameCounts;
+	TArray<float>						FPSs;
+	TArray<float>						SpawnTimes;
+	TArray<int32>						StartFrames;
+	TArray<uint8>						Loops;
+	/** Selected frame */
+	TArray<int32>						Frames;
+	/** Frame whose instance is expanded, INDEX_NONE when none is */
+	TArray<int32>						ShownFrames;
+
+	bool								bInitialized;
+	bool								bHeadless;
+};
@@ -0,0 +1,137 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterSoundConcurrency.h"
+
+void FShooterSoundConcurrency::Init(int32 SlotCount)
+{
+	Empty();
+
+	SlotCues.SetNumZeroed(SlotCount);
+	SlotGroups.SetNumZeroed(SlotCount);
+	SlotSpatialized.SetNumZeroed(SlotCount);
+	SlotLocations.SetNumZeroed(SlotCount);
+	SlotFrames.SetNumZeroed(SlotCount);
+	SlotInstances.SetNumZeroed(SlotCount);
+}
+
+void FShooterSoundConcurrency::Empty()
+{
+	CueSlots.Empty();
+
+	for (int32 Group = 0; Group < EShooterSoundGroup::EShooterSoundGroup_MAX; Group++)
+	{
+		GroupSlots[Group].Empty();
+	}
+
+	SlotCues.Empty();
+	SlotGroups.Empty();
+	SlotSpatialized.Empty();
+	SlotLocations.Empty();
+	SlotFrames.Empty();
+	SlotInstances.Empty();
+}
+
+void FShooterSoundConcurrency::Add(int32 Slot, const USoundCue* Cue, uint8 Group, bool bSpatialized, const FVector& Location)
+{
+	check(Group < EShooterSoundGroup::EShooterSoundGroup_MAX);
+
+	Remove(Slot);
+
+	CueSlots.FindOrAdd(Cue).Add(Slot);
+	GroupSlots[Group].Add(Slot);
+
+	SlotCues[Slot]		  = Cue;
+	SlotGroups[Slot]	  = Group;
+	SlotSpatialized[Slot] = bSpatialized;
+	SlotLocations[Slot]	  = Location;
+	SlotFrames[Slot]	  = GFrameCounter;
+	SlotInstances[Slot]	  = 1;
+}
+
+void FShooterSoundConcurrency::Remove(int32 Slot)
+{
+	// Sounds reset before Init() or after Empty() were never tracked
+	if (!SlotCues.IsValidIndex(Slot) || !SlotCues[Slot])
+		return;
+
+	TArray<int32>* Slots = CueSlots.Find(SlotCues[Slot]);
+
+	if (Slots)
+	{
+		Slots->RemoveSingleSwap(Slot, false);
+
+		if (Slots->Num() == 0)
+		{
+			CueSlots.Remove(SlotCues[Slot]);
+		}
+	}
+
+	GroupSlots[SlotGroups[Slot]].RemoveSingleSwap(Slot, false);
+
+	SlotCues[Slot]		= NULL;
+	SlotInstances[Slot] = 0;
+}
+
+FShooterSoundConcurrencyLimit FShooterSoundConcurrency::GetCueLimit(const USoundCue* Cue)
+{
+	// Unlimited unless the cue asks for a limit, the groups cap what they need to
+	if (!Cue->bOverrideConcurrency)
+		return FShooterSoundConcurrencyLimit(0, EShooterSoundConcurrencyPolicy::StealOldest);
+
+	const FSoundConcurrencySettings& Settings = Cue->ConcurrencyOverrides;
+
+	switch (Settings.ResolutionRule)
+	{
+	case EMaxConcurrentResolutionRule::PreventNew:
+		return FShooterSoundConcurrencyLimit(Settings.MaxCount, EShooterSoundConcurrencyPolicy::RejectNew);
+	case EMaxConcurrentResolutionRule::StopOldest:
+		return FShooterSoundConcurrencyLimit(Settings.MaxCount, EShooterSoundConcurrencyPolicy::StealOldest);
+	default:
+		// Farthest / quietest rules, distance is already part of the audibility
+		return FShooterSoundConcurrencyLimit(Settings.MaxCount, EShooterSoundConcurrencyPolicy::StealQuietest);
+	}
+}
+
+const FShooterSoundConcurrencyLimit& FShooterSoundConcurrency::GetGroupLimit(uint8 Group)
+{
+	static const FShooterSoundConcurrencyLimit GroupLimits[EShooterSoundGroup::EShooterSoundGroup_MAX] =
+	{
+		FShooterSoundConcurrencyLimit(0,  EShooterSoundConcurrencyPolicy::StealOldest),		// Default
+		FShooterSoundConcurrencyLimit(6,  EShooterSoundConcurrencyPolicy::StealQuietest),	// Explosion
+		FShooterSoundConcurrencyLimit(8,  EShooterSoundConcurrencyPolicy::StealQuietest),	// Destruction
+		FShooterSoundConcurrencyLimit(8,  EShooterSoundConcurrencyPolicy::StealOldest),		// ParticleTrigger
+		FShooterSoundConcurrencyLimit(0,  EShooterSoundConcurrencyPolicy::RejectNew),		// VO, only cut off by an interrupting VO
+	};
+
+	check(Group < EShooterSoundGroup::EShooterSoundGroup_MAX);
+	return GroupLimits[Group];
+}
+
+int32 FShooterSoundConcurrency::FindCoalesceSlot(const USoundCue* Cue, bool bSpatialized, const FVector& Location, float RadiusSq) const
+{
+	const TArray<int32>* Slots = CueSlots.Find(Cue);
+
+	if (!Slots)
+		return INDEX_NONE;
+
+	const int32 Count = Slots->Num();
+
+	for (int32 Position = 0; Position < Count; Position++)
+	{
+		const int32 Slot = (*Slots)[Position];
+
+		if (SlotFrames[Slot] != GFrameCounter || SlotSpatialized[Slot] != (uint8)bSpatialized)
+			continue;
+
+		// 2D sounds play the same wherever they were allocated
+		if (!bSpatialized || FVector::DistSquared(SlotLocations[Slot], Location) <= RadiusSq)
+			return Slot;
+	}
+	return INDEX_NONE;
+}
+
+int32 FShooterSoundConcurrency::Coalesce(int32 Slot)
+{
+	return ++SlotInstances[Slot];
+}
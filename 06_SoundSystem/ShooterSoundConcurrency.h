@@ -0,0 +1,106 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/** Concurrency groups, every group has its own limit on top of the per cue one. */
+namespace EShooterSoundGroup
+{
+	enum Type
+	{
+		Default,
+		Explosion,
+		Destruction,
+		ParticleTrigger,
+		VO,
+		EShooterSoundGroup_MAX,
+	};
+}
+
+/** What happens to a new sound when its cue or group is at its limit. */
+namespace EShooterSoundConcurrencyPolicy
+{
+	enum Type
+	{
+		StealOldest,
+		StealQuietest,
+		RejectNew,
+	};
+}
+
+struct FShooterSoundConcurrencyLimit
+{
+	/** Most sounds at once, 0 for no limit */
+	int32								 MaxCount;
+	EShooterSoundConcurrencyPolicy::Type Policy;
+
+	FShooterSoundConcurrencyLimit(int32 InMaxCount, EShooterSoundConcurrencyPolicy::Type InPolicy)
+		: MaxCount(InMaxCount)
+		, Policy(InPolicy)
+	{
+	}
+};
+
+/**
+* Active one-shots per cue and per concurrency group, owned by AShooterGameState and indexed by
+* sound pool slot.
+*
+* A cue's slots are kept in a map and a group's in a plain array, both only ever hold up to
+* their limit, so resolving a limit is a short scan over the slots of one cue or group. The
+* frame a slot was allocated in is kept too, a same cue allocated again in that frame close to
+* it is merged into it instead of taking another slot.
+*/
+class FShooterSoundConcurrency
+{
+public:
+	void Init(int32 SlotCount);
+	void Empty();
+
+	/** Slot was activated with Cue. */
+	void Add(int32 Slot, const USoundCue* Cue, uint8 Group, bool bSpatialized, const FVector& Location);
+
+	/** Slot was deallocated, tracked or not. */
+	void Remove(int32 Slot);
+
+	/** @return slots playing Cue, NULL when there are none. */
+	inline const TArray<int32>* GetCueSlots(const USoundCue* Cue) const
+	{
+		return CueSlots.Find(Cue);
+	}
+
+	inline const TArray<int32>& GetGroupSlots(uint8 Group) const
+	{
+		return GroupSlots[Group];
+	}
+
+	/** Cue's own concurrency override when it has one, unlimited otherwise. */
+	static FShooterSoundConcurrencyLimit GetCueLimit(const USoundCue* Cue);
+
+	static const FShooterSoundConcurrencyLimit& GetGroupLimit(uint8 Group);
+
+	/**
+	* Slot allocated this frame with Cue, within sqrt(RadiusSq) of Location when spatialized.
+	* @return the slot or INDEX_NONE.
+	*/
+	int32 FindCoalesceSlot(const USoundCue* Cue, bool bSpatialized, const FVector& Location, float RadiusSq) const;
+
+	/** Merge one more instance into Slot. @return number of instances Slot plays for now. */
+	int32 Coalesce(int32 Slot);
+
+	/** @return number of instances Slot plays for, 0 when it is not tracked. */
+	inline int32 GetInstances(int32 Slot) const
+	{
+		return SlotInstances.IsValidIndex(Slot) ? SlotInstances[Slot] : 0;
+	}
+
+private:
+	TMap<const USoundCue*, TArray<int32>> CueSlots;
+	TArray<int32>						  GroupSlots[EShooterSoundGroup::EShooterSoundGroup_MAX];
+
+	/** Cue of a slot, NULL when the slot is not tracked */
+	TArray<const USoundCue*>			  SlotCues;
+	TArray<uint8>						  SlotGroups;
+	TArray<uint8>						  SlotSpatialized;
+	TArray<FVector>						  SlotLocations;
+	TArray<uint64>						  SlotFrames;
+	TArray<int32>						  SlotInstances;
+};
@@ -0,0 +1,108 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterVoiceManager.h"
+
+FShooterVoiceManager::FShooterVoiceManager()
+	: MaxVoices(0)
+{
+}
+
+void FShooterVoiceManager::Init(int32 SlotCount, int32 InMaxVoices)
+{
+	Voices.Init(SlotCount);
+	Pending.Init(SlotCount);
+	PendingVoiceKeys.SetNum(SlotCount);
+
+	MaxVoices = InMaxVoices;
+}
+
+void FShooterVoiceManager::Empty()
+{
+	Voices.Empty();
+	Pending.Empty();
+	PendingVoiceKeys.Empty();
+
+	MaxVoices = 0;
+}
+
+bool FShooterVoiceManager::Request(int32 Slot, const FShooterVoiceKey& Key, float Now, int32& OutStolenSlot)
+{
+	OutStolenSlot = INDEX_NONE;
+
+	if (Voices.Contains(Slot))
+		return true;
+
+	// Free voice
+	if (Voices.Num() < MaxVoices)
+	{
+		Pending.Remove(Slot);
+		Voices.Update(Slot, Key);
+		return true;
+	}
+
+	// Steal the weakest voice, but only from a lower class so equal sounds never steal each other
+	if (!Voices.IsEmpty())
+	{
+		const int32 Victim = Voices.Top();
+
+		if (Voices.GetKey(Victim).Priority < Key.Priority)
+		{
+			Voices.Remove(Victim);
+			Pending.Remove(Slot);
+			Voices.Update(Slot, Key);
+
+			OutStolenSlot = Victim;
+			return true;
+		}
+	}
+
+	// Wait for a voice, keep the first request time if it was already waiting
+	if (!Pending.Contains(Slot))
+	{
+		Pending.Update(Slot, FShooterVoicePendingKey(Key.Priority, Now));
+	}
+	PendingVoiceKeys[Slot] = Key;
+	return false;
+}
+
+bool FShooterVoiceManager::Release(int32 Slot)
+{
+	// Sounds reset before Init() or after Empty() were never given a voice
+	if (!PendingVoiceKeys.IsValidIndex(Slot))
+		return false;
+
+	if (!Voices.Contains(Slot))
+	{
+		Pending.Remove(Slot);
+		return false;
+	}
+
+	Voices.Remove(Slot);
+	return true;
+}
+
+int32 FShooterVoiceManager::PopPending()
+{
+	if (Pending.IsEmpty() || Voices.Num() >= MaxVoices)
+		return INDEX_NONE;
+
+	const int32 Slot = Pending.Top();
+
+	Pending.Remove(Slot);
+	Voices.Update(Slot, PendingVoiceKeys[Slot]);
+
+	return Slot;
+}
+
+void FShooterVoiceManager::UpdateVoice(int32 Slot, const FShooterVoiceKey& Key)
+{
+	if (Voices.Contains(Slot))
+	{
+		Voices.Update(Slot, Key);
+	}
+	else if (Pending.Contains(Slot))
+	{
+		PendingVoiceKeys[Slot] = Key;
+	}
+}
@@ -0,0 +1,172 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterPoolAllocator.h"
+
+/** Voice priority classes, a sound only ever steals the voice of a lower class. */
+namespace EShooterVoicePriority
+{
+	enum Type
+	{
+		Ambient,
+		Sound3P,
+		Sound1P,
+		MustPlay,
+		VO,
+		EShooterVoicePriority_MAX,
+	};
+}
+
+/** Playing voice order, the smallest key is the first to be stolen. */
+struct FShooterVoiceKey
+{
+	uint8 Priority;
+	float Audibility;
+	float StartTime;
+
+	FShooterVoiceKey()
+		: Priority(EShooterVoicePriority::Ambient)
+		, Audibility(0.0f)
+		, StartTime(0.0f)
+	{
+	}
+
+	FShooterVoiceKey(uint8 InPriority, float InAudibility, float InStartTime)
+		: Priority(InPriority)
+		, Audibility(InAudibility)
+		, StartTime(InStartTime)
+	{
+	}
+
+	/** Lower class first, then quieter, then older. */
+	inline bool operator<(const FShooterVoiceKey& Other) const
+	{
+		if (Priority != Other.Priority)
+			return Priority < Other.Priority;
+		if (Audibility != Other.Audibility)
+			return Audibility < Other.Audibility;
+		return StartTime < Other.StartTime;
+	}
+};
+
+/** Pending queue order, the smallest key gets the next free voice. */
+struct FShooterVoicePendingKey
+{
+	uint8 Priority;
+	float RequestTime;
+
+	FShooterVoicePendingKey()
+		: Priority(EShooterVoicePriority::Ambient)
+		, RequestTime(0.0f)
+	{
+	}
+
+	FShooterVoicePendingKey(uint8 InPriority, float InRequestTime)
+		: Priority(InPriority)
+		, RequestTime(InRequestTime)
+	{
+	}
+
+	/** Higher class first, first come first served within a class. */
+	inline bool operator<(const FShooterVoicePendingKey& Other) const
+	{
+		return Priority != Other.Priority ? Priority > Other.Priority : RequestTime < Other.RequestTime;
+	}
+};
+
+/**
+* One-shot that was out of earshot when it was allocated. It holds no sound actor and no voice,
+* it becomes a real sound if the listener gets within Range before EndTime.
+*/
+struct FShooterVirtualSound
+{
+	TWeakObjectPtr<USoundCue> Cue;
+	FVector					  Location;
+	float					  RangeSq;
+	float					  SpawnTime;
+	float					  EndTime;
+	/** EShooterSoundGroup it was allocated with */
+	uint8					  ConcurrencyGroup;
+};
+
+/**
+* Voices of the sound pool, owned by AShooterGameState and indexed by sound pool slot.
+*
+* At most MaxVoices sounds play at once. Playing slots are kept in an indexed min-heap keyed on
+* FShooterVoiceKey, so the voice to steal is always the top and every request / release is
+* O(log n). A request that neither finds a free voice nor outranks the top waits in a pending
+* heap, which is only looked at when a voice is released instead of being retried every frame.
+*/
+class FShooterVoiceManager
+{
+public:
+	FShooterVoiceManager();
+
+	void Init(int32 SlotCount, int32 InMaxVoices);
+	void Empty();
+
+	/**
+	* Slot wants to play.
+	* @param OutStolenSlot - voice Slot took over, INDEX_NONE if a voice was free. The caller stops it.
+	* @return true when Slot has a voice now, false when it was queued as pending.
+	*/
+	bool Request(int32 Slot, const FShooterVoiceKey& Key, float Now, int32& OutStolenSlot);
+
+	/**
+	* Slot stopped, playing or not.
+	* @return true when it held a voice, the caller can hand that voice to PopPending().
+	*/
+	bool Release(int32 Slot);
+
+	/** Move the first pending slot onto a free voice. @return the slot or INDEX_NONE. */
+	int32 PopPending();
+
+	/** Re-key a playing slot, e.g. when its audibility changed. */
+	void UpdateVoice(int32 Slot, const FShooterVoiceKey& Key);
+
+	inline bool IsPlaying(int32 Slot) const
+	{
+		return Voices.Contains(Slot);
+	}
+
+	inline bool IsPending(int32 Slot) const
+	{
+		return Pending.Contains(Slot);
+	}
+
+	inline int32 NumVoices() const
+	{
+		return Voices.Num();
+	}
+
+	inline int32 NumPending() const
+	{
+		return Pending.Num();
+	}
+
+	inline int32 GetMaxVoices() const
+	{
+		return MaxVoices;
+	}
+
+	/** Call Func(int32 Slot) for every playing slot. Func must not request or release voices. */
+	template<typename FuncType>
+	void ForEachVoice(FuncType Func) const
+	{
+		const int32 Count = Voices.Num();
+
+		for (int32 Position = 0; Position < Count; Position++)
+		{
+			Func(Voices.GetAt(Position));
+		}
+	}
+
+private:
+	TShooterPoolHeap<FShooterVoiceKey>		  Voices;
+	TShooterPoolHeap<FShooterVoicePendingKey> Pending;
+	/** Voice key a pending slot plays with once it gets a voice */
+	TArray<FShooterVoiceKey>				  PendingVoiceKeys;
+
+	int32 MaxVoices;
+};
@@ -0,0 +1,96 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* Hash index over one of AShooterGameState's Loaded* data arrays.
+*
+* Maps short codes, common names and alternative names to the data's index in the array, and
+* keeps the short code of every index the other way round.
+* FName compares and hashes case-insensitively, so a lookup is the same as the old
+* ToString().ToLower() compare without building any strings. The Loaded* arrays are only
+* ever appended to, by AddLoadedAsset, which adds to the index at the same time. When a name
+* is used by more than one entry the first one added wins, like the old linear search.
+*/
+class FShooterDataIndex
+{
+public:
+	void AddShortCode(FName ShortCode, int32 Index)
+	{
+		if (!ShortCodes.Contains(ShortCode))
+		{
+			ShortCodes.Add(ShortCode, Index);
+		}
+	}
+
+	void AddCommonName(FName CommonName, int32 Index)
+	{
+		if (!CommonNames.Contains(CommonName))
+		{
+			CommonNames.Add(CommonName, Index);
+		}
+	}
+
+	/** Index Data at Index by ShortCode, its Name and all its AlternativeNames. */
+	template<typename T>
+	void Add(int32 Index, FName ShortCode, const T* Data)
+	{
+		AddShortCode(ShortCode, Index);
+
+		if (IndexShortCodes.Num() <= Index)
+		{
+			IndexShortCodes.SetNum(Index + 1);
+		}
+		IndexShortCodes[Index] = ShortCode;
+
+		if (!Data)
+			return;
+
+		AddCommonName(Data->Name, Index);
+
+		const int32 NumNames = Data->AlternativeNames.Num();
+
+		for (int32 J = 0; J < NumNames; J++)
+		{
+			AddCommonName(Data->AlternativeNames[J], Index);
+		}
+	}
+
+	void Empty()
+	{
+		ShortCodes.Empty();
+		CommonNames.Empty();
+		IndexShortCodes.Empty();
+	}
+
+	inline bool ContainsShortCode(FName ShortCode) const
+	{
+		return ShortCodes.Contains(ShortCode);
+	}
+
+	/** @return short code the data at Index was added with, NAME_None when there is none. */
+	inline FName GetShortCode(int32 Index) const
+	{
+		return IndexShortCodes.IsValidIndex(Index) ? IndexShortCodes[Index] : NAME_None;
+	}
+
+	/** @return index of the data with ShortCode or INDEX_NONE. */
+	inline int32 FindShortCode(FName ShortCode) const
+	{
+		const int32* Index = ShortCodes.Find(ShortCode);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	/** @return index of the data with Name or an AlternativeName of CommonName, or INDEX_NONE. */
+	inline int32 FindCommonName(FName CommonName) const
+	{
+		const int32* Index = CommonNames.Find(CommonName);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+private:
+	TMap<FName, int32> ShortCodes;
+	TMap<FName, int32> CommonNames;
+	/** Short code of every index, parallel to the Loaded* array */
+	TArray<FName>	   IndexShortCodes;
+};
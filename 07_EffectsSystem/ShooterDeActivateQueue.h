@@ -0,0 +1,198 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* FIFO of pooled objects that take several frames to deactivate, owned by AShooterGameState.
+*
+* Objects are registered once with Add(), the queue then holds their slots in a ring buffer:
+* - Push() / Pop() are O(1), nothing is shifted when the front leaves.
+* - Every registered object keeps its position in the ring (INDEX_NONE when it is not queued), so
+*   Contains() and Remove() are O(1). Remove() leaves a hole that Pop() skips.
+* - Pushing an object that is already queued is ignored.
+* - A full ring is compacted in place when holes make up at least half of it, so a queue that
+*   keeps removing does not grow, and doubles otherwise. Both drop the holes on the way.
+*/
+template<typename T>
+class TShooterDeActivateQueue
+{
+public:
+	TShooterDeActivateQueue()
+		: Head(0)
+		, Used(0)
+		, Queued(0)
+	{
+	}
+
+	void Reserve(int32 Count)
+	{
+		Items.Reserve(Count);
+		Positions.Reserve(Count);
+		IndexMapping.Reserve(Count);
+	}
+
+	/** Register an object, not queued. */
+	int32 Add(T* Item)
+	{
+		const int32 Slot = Items.Add(Item);
+
+		Positions.Add(INDEX_NONE);
+		IndexMapping.Add(Item, Slot);
+
+		return Slot;
+	}
+
+	void Empty()
+	{
+		Items.Empty();
+		Positions.Empty();
+		IndexMapping.Empty();
+		Ring.Empty();
+
+		Head   = 0;
+		Used   = 0;
+		Queued = 0;
+	}
+
+	/** @return number of queued objects. */
+	inline int32 Num() const
+	{
+		return Queued;
+	}
+
+	inline bool Contains(const T* Item) const
+	{
+		const int32* Slot = IndexMapping.Find(Item);
+		return Slot && Positions[*Slot] != INDEX_NONE;
+	}
+
+	/** Queue Item at the back. @return false when it is already queued. */
+	bool Push(T* Item)
+	{
+		const int32* Slot = IndexMapping.Find(Item);
+		check(Slot);
+
+		if (Positions[*Slot] != INDEX_NONE)
+			return false;
+
+		if (Used == Ring.Num())
+		{
+			if (Queued < Ring.Num() / 2)
+			{
+				Compact();
+			}
+			else
+			{
+				Grow();
+			}
+		}
+
+		const int32 Position = (Head + Used) & (Ring.Num() - 1);
+
+		Ring[Position]	 = *Slot;
+		Positions[*Slot] = Position;
+		Used++;
+		Queued++;
+
+		return true;
+	}
+
+	/** Take Item out wherever it is queued. @return false when it was not queued. */
+	bool Remove(const T* Item)
+	{
+		const int32* Slot = IndexMapping.Find(Item);
+
+		if (!Slot || Positions[*Slot] == INDEX_NONE)
+			return false;
+
+		Ring[Positions[*Slot]] = INDEX_NONE;
+		Positions[*Slot]	   = INDEX_NONE;
+		Queued--;
+
+		return true;
+	}
+
+	/** @return front object, taken out of the queue, or NULL when it is empty. */
+	T* Pop()
+	{
+		while (Used > 0)
+		{
+			const int32 Slot = Ring[Head];
+
+			Head = (Head + 1) & (Ring.Num() - 1);
+			Used--;
+
+			if (Slot != INDEX_NONE)
+			{
+				Positions[Slot] = INDEX_NONE;
+				Queued--;
+
+				return Items[Slot];
+			}
+		}
+		return NULL;
+	}
+
+private:
+	/** Close the holes in place, queued slots keep their order from Head. */
+	void Compact()
+	{
+		const int32 Mask = Ring.Num() - 1;
+		int32 Count		 = 0;
+
+		// The write position never passes the read position, nothing is overwritten before it is read
+		for (int32 Offset = 0; Offset < Used; Offset++)
+		{
+			const int32 Slot = Ring[(Head + Offset) & Mask];
+
+			if (Slot != INDEX_NONE)
+			{
+				const int32 Position = (Head + Count) & Mask;
+
+				Ring[Position]	= Slot;
+				Positions[Slot] = Position;
+				Count++;
+			}
+		}
+
+		Used = Count;
+	}
+
+	/** Double the ring (power of two), queued slots move to the front in order. */
+	void Grow()
+	{
+		const int32 MIN_RING_SIZE = 64;
+
+		TArray<int32> NewRing;
+		NewRing.SetNumUninitialized(FMath::Max(Ring.Num() * 2, MIN_RING_SIZE));
+
+		int32 Count = 0;
+
+		for (int32 Offset = 0; Offset < Used; Offset++)
+		{
+			const int32 Slot = Ring[(Head + Offset) & (Ring.Num() - 1)];
+
+			if (Slot != INDEX_NONE)
+			{
+				NewRing[Count]	= Slot;
+				Positions[Slot] = Count;
+				Count++;
+			}
+		}
+
+		Ring = MoveTemp(NewRing);
+		Head = 0;
+		Used = Count;
+	}
+
+	TArray<T*>				Items;
+	/** Position of every registered slot in Ring, INDEX_NONE when it is not queued */
+	TArray<int32>			Positions;
+	TMap<const T*, int32>	IndexMapping;
+	/** Queued slots from Head, INDEX_NONE for the holes Remove() left */
+	TArray<int32>			Ring;
+	int32					Head;
+	/** Ring entries in use from Head, holes included */
+	int32					Used;
+	int32					Queued;
+};
@@ -0,0 +1,28 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* One AShooterGameState::Explode() call waiting for its batch to be resolved.
+* Everything that does not depend on the damaged pawn is resolved when the request is queued
+* (damage class, instigator player state / controller), the batch only runs the per pawn part.
+*/
+struct FShooterExplosionRequest
+{
+	FVector								Location;
+	float								RadiusSq;
+	float								HalfHeight;
+	int32								Damage;
+	TSubclassOf<class UDamageType>		DamageClass;
+	TWeakObjectPtr<AShooterPlayerState> InstigatorPlayerState;
+	TWeakObjectPtr<AController>			InstigatorController;
+	bool								bSelfDamage;
+	bool								bAlliedDamage;
+};
+
+/** Pawn hit by a request, in the order damage is applied. */
+struct FShooterExplosionHit
+{
+	int32			   RequestIndex;
+	AShooterCharacter* Pawn;
+};
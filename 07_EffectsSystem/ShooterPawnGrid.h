@@ -0,0 +1,281 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* Uniform spatial hash of the live AShooterCharacters in a world.
+*
+* Pawns are bucketed by their XY cell (CellSize units) and stored sorted by cell, so a query only
+* visits the cells overlapping its radius instead of every pawn in the world. Z is not hashed,
+* maps are mostly flat and every query that cares about height (cylinder) filters on it.
+*
+* Positions are kept as SoA (LocationsX / Y / Z) so batch passes can run plain loops over all pawns.
+* Slot order is stable for a given set of pawn positions (stable sort on cell), batch results
+* that follow it are deterministic.
+*
+* The grid is a snapshot: AShooterGameState::GetPawnGrid() rebuilds it at most once per frame
+* (or when the world pawn count changed), queries skip pawns that got destroyed since.
+*/
+class FShooterPawnGrid
+{
+public:
+	FShooterPawnGrid()
+		: CellSize(1000.0f)
+		, BuildFrame(0)
+		, BuildPawnCount(INDEX_NONE)
+	{
+	}
+
+	/** Grid is stale for World if it was built on an earlier frame or pawns were spawned / destroyed since. */
+	inline bool NeedsRebuild(UWorld* World) const
+	{
+		return BuildFrame != GFrameCounter || BuildPawnCount != World->GetNumPawns();
+	}
+
+	void Build(UWorld* World)
+	{
+		Entries.Reset();
+		Cells.Reset();
+		Pawns.Reset();
+		LocationsX.Reset();
+		LocationsY.Reset();
+		LocationsZ.Reset();
+
+		for (FConstPawnIterator It = World->GetPawnIterator(); It; ++It)
+		{
+			AShooterCharacter* Pawn = Cast<AShooterCharacter>(*It);
+
+			if (!Pawn || Pawn->IsPendingKill())
+				continue;
+
+			FShooterPawnGridEntry Entry;
+			Entry.Pawn	   = Pawn;
+			Entry.Location = Pawn->GetActorLocation();
+			Entry.Cell	   = GetCell(Entry.Location.X, Entry.Location.Y);
+			Entries.Add(Entry);
+		}
+
+		// Sort by cell so every cell is one contiguous range, stable so equal cells keep pawn iterator order
+		Entries.StableSort([](const FShooterPawnGridEntry& A, const FShooterPawnGridEntry& B)
+		{
+			return A.Cell.X != B.Cell.X ? A.Cell.X < B.Cell.X : A.Cell.Y < B.Cell.Y;
+		});
+
+		const int32 Count = Entries.Num();
+
+		Pawns.Reserve(Count);
+		LocationsX.Reserve(Count);
+		LocationsY.Reserve(Count);
+		LocationsZ.Reserve(Count);
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Pawns.Add(Entries[Index].Pawn);
+			LocationsX.Add(Entries[Index].Location.X);
+			LocationsY.Add(Entries[Index].Location.Y);
+			LocationsZ.Add(Entries[Index].Location.Z);
+
+			FShooterPawnGridCell* Cell = Cells.Find(Entries[Index].Cell);
+
+			if (Cell)
+			{
+				Cell->Num++;
+			}
+			else
+			{
+				Cells.Add(Entries[Index].Cell, FShooterPawnGridCell(Index, 1));
+			}
+		}
+
+		BuildFrame	   = GFrameCounter;
+		BuildPawnCount = World->GetNumPawns();
+	}
+
+	inline int32 Num() const
+	{
+		return Pawns.Num();
+	}
+
+	/** Pawn in Slot, may have been destroyed since the grid was built. */
+	inline AShooterCharacter* GetPawn(int32 Slot) const
+	{
+		return Pawns[Slot];
+	}
+
+	inline const float* GetLocationsX() const
+	{
+		return LocationsX.GetData();
+	}
+
+	inline const float* GetLocationsY() const
+	{
+		return LocationsY.GetData();
+	}
+
+	inline const float* GetLocationsZ() const
+	{
+		return LocationsZ.GetData();
+	}
+
+	/** Call Func(AShooterCharacter*) for every pawn within Radius of Center. */
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Center, float Radius, FuncType Func) const
+	{
+		const float RadiusSq = Radius * Radius;
+
+		VisitCandidates(Center, Radius, [&](const FShooterPawnGridEntry& Entry)
+		{
+			if ((Entry.Location - Center).SizeSquared() < RadiusSq)
+				Func(Entry.Pawn);
+			return true;
+		});
+	}
+
+	/** Call Func(AShooterCharacter*) for every pawn within Radius of Center on the XY plane, any height. */
+	template<typename FuncType>
+	void ForEachInRadius2D(const FVector& Center, float Radius, FuncType Func) const
+	{
+		const float RadiusSq = Radius * Radius;
+
+		VisitCandidates(Center, Radius, [&](const FShooterPawnGridEntry& Entry)
+		{
+			if (FVector::DistSquaredXY(Entry.Location, Center) < RadiusSq)
+				Func(Entry.Pawn);
+			return true;
+		});
+	}
+
+	/** Call Func(AShooterCharacter*) for every pawn within Radius of Center on the XY plane and within HalfHeight on Z. */
+	template<typename FuncType>
+	void ForEachInCylinder(const FVector& Center, float Radius, float HalfHeight, FuncType Func) const
+	{
+		const float RadiusSq = Radius * Radius;
+
+		VisitCandidates(Center, Radius, [&](const FShooterPawnGridEntry& Entry)
+		{
+			if (FVector::DistSquaredXY(Entry.Location, Center) < RadiusSq &&
+				FMath::Abs(Entry.Location.Z - Center.Z) < HalfHeight)
+				Func(Entry.Pawn);
+			return true;
+		});
+	}
+
+	/** @return true as soon as one pawn is found within Radius of Center. */
+	bool AnyInRadius(const FVector& Center, float Radius) const
+	{
+		const float RadiusSq = Radius * Radius;
+		bool bFound			 = false;
+
+		VisitCandidates(Center, Radius, [&](const FShooterPawnGridEntry& Entry)
+		{
+			bFound = (Entry.Location - Center).SizeSquared() < RadiusSq;
+			return !bFound;
+		});
+		return bFound;
+	}
+
+	/** @return closest pawn within MaxRadius of Center or NULL. */
+	AShooterCharacter* FindNearest(const FVector& Center, float MaxRadius) const
+	{
+		AShooterCharacter* Nearest = NULL;
+		float NearestDistSq		   = MaxRadius * MaxRadius;
+
+		VisitCandidates(Center, MaxRadius, [&](const FShooterPawnGridEntry& Entry)
+		{
+			const float DistSq = (Entry.Location - Center).SizeSquared();
+
+			if (DistSq < NearestDistSq)
+			{
+				NearestDistSq = DistSq;
+				Nearest		  = Entry.Pawn;
+			}
+			return true;
+		});
+		return Nearest;
+	}
+
+private:
+	struct FShooterPawnGridEntry
+	{
+		AShooterCharacter* Pawn;
+		FVector			   Location;
+		FIntPoint		   Cell;
+	};
+
+	struct FShooterPawnGridCell
+	{
+		int32 Start;
+		int32 Num;
+
+		FShooterPawnGridCell(int32 InStart, int32 InNum)
+			: Start(InStart)
+			, Num(InNum)
+		{
+		}
+	};
+
+	inline FIntPoint GetCell(float X, float Y) const
+	{
+		return FIntPoint(FMath::FloorToInt(X / CellSize), FMath::FloorToInt(Y / CellSize));
+	}
+
+	/**
+	* Call Visit(Entry) for every live pawn in the cells overlapping the XY square around Center,
+	* stops when Visit returns false. Falls back to a linear walk when the square spans more cells
+	* than there are pawns (huge radius).
+	*/
+	template<typename FuncType>
+	void VisitCandidates(const FVector& Center, float Radius, FuncType Visit) const
+	{
+		const int32 Count = Entries.Num();
+
+		if (Count == 0)
+			return;
+
+		const FIntPoint Min = GetCell(Center.X - Radius, Center.Y - Radius);
+		const FIntPoint Max = GetCell(Center.X + Radius, Center.Y + Radius);
+
+		const int64 CellCount = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+
+		if (CellCount >= Count)
+		{
+			for (int32 Index = 0; Index < Count; Index++)
+			{
+				if (!Entries[Index].Pawn->IsPendingKill() && !Visit(Entries[Index]))
+					return;
+			}
+			return;
+		}
+
+		for (int32 X = Min.X; X <= Max.X; X++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				const FShooterPawnGridCell* Cell = Cells.Find(FIntPoint(X, Y));
+
+				if (!Cell)
+					continue;
+
+				const int32 End = Cell->Start + Cell->Num;
+
+				for (int32 Index = Cell->Start; Index < End; Index++)
+				{
+					if (!Entries[Index].Pawn->IsPendingKill() && !Visit(Entries[Index]))
+						return;
+				}
+			}
+		}
+	}
+
+	/** Sorted by cell, walked by the cell queries */
+	TArray<FShooterPawnGridEntry>			 Entries;
+	TMap<FIntPoint, FShooterPawnGridCell>	 Cells;
+	/** Per slot (SoA, sorted by cell) */
+	TArray<AShooterCharacter*>				 Pawns;
+	TArray<float>							 LocationsX;
+	TArray<float>							 LocationsY;
+	TArray<float>							 LocationsZ;
+	float									 CellSize;
+	uint64									 BuildFrame;
+	int32									 BuildPawnCount;
+};
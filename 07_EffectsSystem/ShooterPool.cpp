@@ -0,0 +1,440 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterPool.h"
+
+#if !UE_BUILD_SHIPPING
+/** Stands in for a pooled actor so the pool can be driven without a world. */
+struct FShooterPoolMockActor
+{
+	FVector Location;
+	float	SpawnTime;
+	bool	bHidden;
+};
+
+typedef TShooterPool<FShooterPoolMockActor, FShooterPoolEvictPriority> FShooterValidationPool;
+
+/** @return number of broken invariants of Pool after Step, every one is logged. InUse is what the pool should hold. */
+static int32 CheckPoolInvariants(const FShooterValidationPool& Pool, const TArray<bool>& InUse, const TCHAR* Step)
+{
+	int32 Errors	   = 0;
+	int32 InUseCount   = 0;
+	bool bHasCandidate = false;
+
+	FShooterPoolPriorityKey BestKey;
+
+	for (int32 Index = 0; Index < Pool.Num(); Index++)
+	{
+		if (Pool.IsInUse(Index) != InUse[Index])
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, slot %d in use %d, expected %d"), Step, Index, Pool.IsInUse(Index), InUse[Index]);
+			Errors++;
+		}
+
+		if (!InUse[Index])
+			continue;
+
+		InUseCount++;
+
+		const FShooterPoolPriorityKey Key = FShooterPoolEvictPriority::GetKey(Pool.GetStartTime(Index), Pool.GetTime(Index), Pool.GetPriority(Index));
+
+		if (!bHasCandidate || Key < BestKey)
+		{
+			BestKey		  = Key;
+			bHasCandidate = true;
+		}
+	}
+
+	if (Pool.NumInUse() != InUseCount || Pool.NumFree() != Pool.Num() - InUseCount)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, %d in use / %d free, expected %d / %d"), Step, Pool.NumInUse(), Pool.NumFree(), InUseCount, Pool.Num() - InUseCount);
+		Errors++;
+	}
+
+	// Active set: every in use slot exactly once
+	const TArray<int32>& ActiveIndices = Pool.GetActiveIndices();
+	TArray<bool> Seen;
+	Seen.Init(false, Pool.Num());
+
+	for (int32 Index : ActiveIndices)
+	{
+		if (!Pool.IsValidIndex(Index) || !InUse[Index] || Seen[Index])
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, active slot %d is free or listed twice"), Step, Index);
+			Errors++;
+			continue;
+		}
+		Seen[Index] = true;
+	}
+
+	if (ActiveIndices.Num() != InUseCount)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, %d active slots, expected %d"), Step, ActiveIndices.Num(), InUseCount);
+		Errors++;
+	}
+
+	// Heap order: the candidate has the smallest key, ties may pick any of the equal slots
+	const int32 Candidate = Pool.GetEvictionCandidate();
+
+	if (!bHasCandidate)
+	{
+		if (Candidate != INDEX_NONE)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, eviction candidate %d of an empty pool"), Step, Candidate);
+			Errors++;
+		}
+	}
+	else if (Candidate == INDEX_NONE || !InUse[Candidate])
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, eviction candidate %d is not in use"), Step, Candidate);
+		Errors++;
+	}
+	else
+	{
+		const FShooterPoolPriorityKey Key = FShooterPoolEvictPriority::GetKey(Pool.GetStartTime(Candidate), Pool.GetTime(Candidate), Pool.GetPriority(Candidate));
+
+		if (BestKey < Key)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: %s, eviction candidate %d (priority %d, start %.2f) is not the smallest (priority %d, start %.2f)"),
+				Step, Candidate, Key.Priority, Key.StartTime, BestKey.Priority, BestKey.StartTime);
+			Errors++;
+		}
+	}
+	return Errors;
+}
+
+/**
+* Drive a priority pool through random Acquire / Release / SetPriority / SetTime calls and check it
+* against a plain in use array after every call: free list, active set and eviction order.
+*/
+static void RunPoolValidation()
+{
+	const int32 SlotCount  = 64;
+	const int32 Operations = 10000;
+
+	FRandomStream Random(0x5eed);
+
+	TArray<FShooterPoolMockActor> Objects;
+	Objects.SetNumZeroed(SlotCount);
+
+	FShooterValidationPool Pool;
+	TArray<bool> InUse;
+	int32 Errors = 0;
+
+	Pool.Reserve(SlotCount);
+	InUse.Init(false, SlotCount);
+
+	for (int32 Index = 0; Index < SlotCount; Index++)
+	{
+		if (Pool.Add(&Objects[Index]) != Index || Pool.Find(&Objects[Index]) != Index)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: object %d was not added as slot %d"), Index, Index);
+			Errors++;
+		}
+	}
+	Errors += CheckPoolInvariants(Pool, InUse, TEXT("Add"));
+
+	// Fill the pool, then it has to refuse
+	float Now = 0.0f;
+
+	for (int32 Count = 0; Count < SlotCount; Count++)
+	{
+		const int32 Index = Pool.Acquire(Now, Random.FRandRange(0.0f, 5.0f), Random.RandHelper(4));
+
+		if (!Pool.IsValidIndex(Index) || InUse[Index])
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: acquire %d of %d handed out slot %d"), Count, SlotCount, Index);
+			Errors++;
+			continue;
+		}
+		InUse[Index] = true;
+		Now			+= 0.01f;
+	}
+
+	if (Pool.Acquire(Now) != INDEX_NONE)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Pool validation: a full pool handed out a slot"));
+		Errors++;
+	}
+	Errors += CheckPoolInvariants(Pool, InUse, TEXT("Fill"));
+
+	// Re-acquire after release: the free list is LIFO, a double release is ignored
+	{
+		const int32 Index = Random.RandHelper(SlotCount);
+
+		Pool.Release(Index);
+		Pool.Release(Index);
+		InUse[Index] = false;
+		Errors		+= CheckPoolInvariants(Pool, InUse, TEXT("Release twice"));
+
+		const int32 Reacquired = Pool.Acquire(Now);
+
+		if (Reacquired != Index)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: released slot %d, re-acquired slot %d"), Index, Reacquired);
+			Errors++;
+		}
+
+		if (Pool.IsValidIndex(Reacquired))
+		{
+			InUse[Reacquired] = true;
+		}
+		Errors += CheckPoolInvariants(Pool, InUse, TEXT("Re-acquire"));
+	}
+
+	// Random traffic
+	for (int32 Operation = 0; Operation < Operations && Errors == 0; Operation++)
+	{
+		const int32 Index = Random.RandHelper(SlotCount);
+		const TCHAR* Step = TEXT("");
+
+		Now += 0.01f;
+
+		switch (Random.RandHelper(4))
+		{
+			case 0:
+			{
+				Step = TEXT("Acquire");
+
+				const int32 Acquired = Pool.Acquire(Now, Random.FRandRange(0.0f, 5.0f), Random.RandHelper(4));
+
+				if (Acquired != INDEX_NONE)
+				{
+					if (InUse[Acquired])
+					{
+						UE_LOG(LogShooter, Warning, TEXT("Pool validation: acquire handed out slot %d which is in use"), Acquired);
+						Errors++;
+					}
+					InUse[Acquired] = true;
+				}
+				break;
+			}
+			case 1:
+				Step = TEXT("Release");
+				Pool.Release(Index);
+				InUse[Index] = false;
+				break;
+			case 2:
+				Step = TEXT("SetPriority");
+				if (InUse[Index])
+				{
+					Pool.SetPriority(Index, Random.RandHelper(4));
+				}
+				break;
+			default:
+				Step = TEXT("SetTime");
+				if (InUse[Index])
+				{
+					Pool.SetTime(Index, Random.FRandRange(0.0f, 5.0f), Now);
+				}
+				break;
+		}
+
+		Errors += CheckPoolInvariants(Pool, InUse, Step);
+	}
+
+	// Untimed slots: a pool that does not evict hands the oldest one out again once it is exhausted
+	{
+		TShooterPool<FShooterPoolMockActor> UntimedPool;
+
+		for (int32 Index = 0; Index < 4; Index++)
+		{
+			UntimedPool.Add(&Objects[Index]);
+		}
+
+		UntimedPool.Acquire(0.0f, 1.0f);
+		const int32 Oldest = UntimedPool.Acquire(1.0f);
+		const int32 Newest = UntimedPool.Acquire(2.0f);
+		UntimedPool.Acquire(3.0f, 1.0f);
+
+		const FShooterPoolHandle OldestHandle = UntimedPool.GetHandle(Oldest);
+		const int32 Recycled				 = UntimedPool.Acquire(4.0f, 1.0f);
+
+		if (Recycled != Oldest || UntimedPool.IsValidHandle(OldestHandle) || UntimedPool.NumInUse() != 4)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: exhausted pool recycled slot %d, expected the oldest untimed slot %d"), Recycled, Oldest);
+			Errors++;
+		}
+
+		if (UntimedPool.Acquire(5.0f) != Newest || UntimedPool.Acquire(6.0f) != Newest)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: exhausted pool did not keep recycling the one untimed slot left"));
+			Errors++;
+		}
+
+		UntimedPool.SetTime(Newest, 1.0f);
+
+		if (UntimedPool.Acquire(7.0f) != INDEX_NONE)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Pool validation: exhausted pool without untimed slots handed out a slot"));
+			Errors++;
+		}
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("Pool validation: %d slots, %d operations, %d errors"), SlotCount, Operations, Errors);
+}
+
+static FAutoConsoleCommand PoolValidationCommand(
+	TEXT("shooter.validatepool"),
+	TEXT("Drive a TShooterPool through random acquire / release / re-time calls and log every free list, active set or eviction order error."),
+	FConsoleCommandDelegate::CreateStatic(&RunPoolValidation)
+	);
+
+/**
+* Pooled effect workload (allocate with 0.5 - 3 second lifetimes, expire, steal the slot that lived
+* enough when full) on mock actors, run over the round-robin Times scans the pools in
+* ShooterGameState used to do and over TShooterPool. Both runs get the same lifetimes.
+*/
+static void RunPoolBenchmark()
+{
+	const int32 PoolSizes[] = { 256, 1024, 4096 };
+	const int32 Frames		= 600;
+	const float DeltaTime	= 1.0f / 60.0f;
+	const float LivedEnough = 0.9f;
+
+	for (int32 PoolSize : PoolSizes)
+	{
+		const int32 AllocationsPerFrame = FMath::Max(PoolSize / 100, 1);
+		const int32 AllocationCount		= Frames * AllocationsPerFrame;
+
+		FRandomStream Random(0x5eed);
+		TArray<float> Lifetimes;
+		Lifetimes.SetNumUninitialized(AllocationCount);
+
+		for (int32 Allocation = 0; Allocation < AllocationCount; Allocation++)
+		{
+			Lifetimes[Allocation] = Random.FRandRange(0.5f, 3.0f);
+		}
+
+		TArray<FShooterPoolMockActor> Actors;
+		Actors.SetNumZeroed(PoolSize);
+
+		// Round-robin: expire by scanning every slot, find a free one from the last index, scan again for a victim
+		int32 RoundRobinSteals = 0;
+		double StartTime	   = FPlatformTime::Seconds();
+		{
+			TArray<float> Times;
+			TArray<float> StartTimes;
+
+			Times.Init(0.0f, PoolSize);
+			StartTimes.Init(0.0f, PoolSize);
+
+			int32 PoolIndex	 = 0;
+			int32 Allocation = 0;
+
+			for (int32 Frame = 0; Frame < Frames; Frame++)
+			{
+				const float Now = Frame * DeltaTime;
+
+				for (int32 Index = 0; Index < PoolSize; Index++)
+				{
+					if (Times[Index] > 0.0f && Now - StartTimes[Index] > Times[Index])
+					{
+						Times[Index]		  = 0.0f;
+						Actors[Index].bHidden = true;
+					}
+				}
+
+				for (int32 Count = 0; Count < AllocationsPerFrame; Count++)
+				{
+					int32 Slot = INDEX_NONE;
+
+					for (int32 Offset = 0; Offset < PoolSize; Offset++)
+					{
+						const int32 Index = (PoolIndex + Offset) % PoolSize;
+
+						if (Times[Index] == 0.0f)
+						{
+							Slot	  = Index;
+							PoolIndex = Index + 1;
+							break;
+						}
+					}
+
+					if (Slot == INDEX_NONE)
+					{
+						float BestKey = MAX_flt;
+
+						for (int32 Index = 0; Index < PoolSize; Index++)
+						{
+							const float Key = StartTimes[Index] + Times[Index] * LivedEnough;
+
+							if (Key < BestKey)
+							{
+								BestKey = Key;
+								Slot	= Index;
+							}
+						}
+						RoundRobinSteals++;
+					}
+
+					Times[Slot]			   = Lifetimes[Allocation++];
+					StartTimes[Slot]	   = Now;
+					Actors[Slot].SpawnTime = Now;
+					Actors[Slot].bHidden   = false;
+				}
+			}
+		}
+		const double RoundRobinMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Frames;
+
+		// TShooterPool: expire over the active indices, free list, eviction heap
+		int32 PoolSteals = 0;
+		StartTime		 = FPlatformTime::Seconds();
+		{
+			TShooterPool<FShooterPoolMockActor, TShooterPoolEvictLivedEnough<90>> Pool;
+			Pool.Reserve(PoolSize);
+
+			for (int32 Index = 0; Index < PoolSize; Index++)
+			{
+				Pool.Add(&Actors[Index]);
+			}
+
+			int32 Allocation = 0;
+
+			for (int32 Frame = 0; Frame < Frames; Frame++)
+			{
+				const float Now = Frame * DeltaTime;
+
+				const TArray<int32>& ActiveIndices = Pool.GetActiveIndices();
+
+				for (int32 Position = ActiveIndices.Num() - 1; Position >= 0; Position--)
+				{
+					const int32 Index = ActiveIndices[Position];
+
+					if (Pool.HasExpired(Index, Now))
+					{
+						Pool[Index]->bHidden = true;
+						Pool.Release(Index);
+					}
+				}
+
+				for (int32 Count = 0; Count < AllocationsPerFrame; Count++)
+				{
+					int32 Slot = Pool.Acquire(Now, Lifetimes[Allocation]);
+
+					if (Slot == INDEX_NONE)
+					{
+						Pool.Release(Pool.GetEvictionCandidate());
+						Slot = Pool.Acquire(Now, Lifetimes[Allocation]);
+						PoolSteals++;
+					}
+					Allocation++;
+
+					Pool[Slot]->SpawnTime = Now;
+					Pool[Slot]->bHidden	 = false;
+				}
+			}
+		}
+		const double PoolMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Frames;
+
+		UE_LOG(LogShooter, Log, TEXT("Pool benchmark: %4d mock actors, %d allocations per frame, round-robin %.4f ms, TShooterPool %.4f ms per frame (%.1fx), steals %d / %d"),
+			PoolSize, AllocationsPerFrame, RoundRobinMs, PoolMs, PoolMs > 0.0 ? RoundRobinMs / PoolMs : 0.0, RoundRobinSteals, PoolSteals);
+	}
+}
+
+static FAutoConsoleCommand PoolBenchmarkCommand(
+	TEXT("shooter.benchmarkpool"),
+	TEXT("Time a TShooterPool of mock actors against the old round-robin pool scans at 256, 1024 and 4096 slots, no world needed."),
+	FConsoleCommandDelegate::CreateStatic(&RunPoolBenchmark)
+	);
+#endif // #if !UE_BUILD_SHIPPING
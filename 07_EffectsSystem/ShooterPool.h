@@ -0,0 +1,476 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterPoolAllocator.h"
+#include "ShooterTimingWheel.h"
+
+/**
+* Eviction policies for TShooterPool.
+* A policy maps a slot's timing (StartTime, Time) and Priority to a KeyType. When the pool is
+* exhausted the in use slot with the smallest key is the eviction candidate.
+*/
+
+/**
+* Never evict a slot with a lifetime. When the pool is exhausted Acquire() hands out the oldest slot
+* acquired with Time 0 again, like the round-robin pools did, and fails only when there is none.
+*/
+struct FShooterPoolEvictNone
+{
+	typedef float KeyType;
+
+	enum { bCanEvict = false };
+	enum { bRecycleUntimed = true };
+
+	static inline KeyType GetKey(float StartTime, float Time, int32 Priority)
+	{
+		return 0.0f;
+	}
+};
+
+/** Evict the slot that was allocated first. */
+struct FShooterPoolEvictOldest
+{
+	typedef float KeyType;
+
+	enum { bCanEvict = true };
+	enum { bRecycleUntimed = false };
+
+	static inline KeyType GetKey(float StartTime, float Time, int32 Priority)
+	{
+		return StartTime;
+	}
+};
+
+/**
+* Evict the slot that reaches RatioPercent of its lifetime first ("lived enough").
+* Slots without a lifetime are keyed on their start time so they go first.
+*/
+template<int32 RatioPercent>
+struct TShooterPoolEvictLivedEnough
+{
+	typedef float KeyType;
+
+	enum { bCanEvict = true };
+	enum { bRecycleUntimed = false };
+
+	static inline KeyType GetKey(float StartTime, float Time, int32 Priority)
+	{
+		return StartTime + FMath::Max(Time, 0.0f) * (RatioPercent / 100.0f);
+	}
+};
+
+struct FShooterPoolPriorityKey
+{
+	int32 Priority;
+	float StartTime;
+
+	FShooterPoolPriorityKey()
+		: Priority(0)
+		, StartTime(0.0f)
+	{
+	}
+
+	FShooterPoolPriorityKey(int32 InPriority, float InStartTime)
+		: Priority(InPriority)
+		, StartTime(InStartTime)
+	{
+	}
+
+	inline bool operator<(const FShooterPoolPriorityKey& Other) const
+	{
+		return Priority != Other.Priority ? Priority < Other.Priority : StartTime < Other.StartTime;
+	}
+};
+
+/** Evict the lowest priority slot, oldest first within the same priority. */
+struct FShooterPoolEvictPriority
+{
+	typedef FShooterPoolPriorityKey KeyType;
+
+	enum { bCanEvict = true };
+	enum { bRecycleUntimed = false };
+
+	static inline KeyType GetKey(float StartTime, float Time, int32 Priority)
+	{
+		return FShooterPoolPriorityKey(Priority, StartTime);
+	}
+};
+
+/**
+* Slot of a TShooterPool as it was handed out.
+* Generation changes every time the slot is released, a handle kept past its DeAllocate no longer
+* resolves even when the slot was handed out again since.
+*/
+struct FShooterPoolHandle
+{
+	int32	Index;
+	uint32	Generation;
+
+	FShooterPoolHandle()
+		: Index(INDEX_NONE)
+		, Generation(0)
+	{
+	}
+
+	FShooterPoolHandle(int32 InIndex, uint32 InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{
+	}
+
+	inline bool IsSet() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	inline void Reset()
+	{
+		Index	   = INDEX_NONE;
+		Generation = 0;
+	}
+
+	inline bool operator==(const FShooterPoolHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+
+	inline bool operator!=(const FShooterPoolHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+/**
+* Fixed set of pre-spawned objects handed out by slot index.
+*
+* - Acquire / Release are O(1) through an intrusive free list.
+* - Timing is stored as parallel arrays (Times / StartTimes / Priorities) indexed by slot,
+*   the same layout the pools in ShooterGameState always used for their per pool data.
+* - Policy decides which in use slot GetEvictionCandidate() returns, kept in an indexed heap
+*   so it is O(1) to read and O(log n) to maintain. FShooterPoolEvictNone skips the heap.
+* - With FShooterPoolEvictNone a slot acquired with Time 0 has no lifetime and nobody has to
+*   release it: an exhausted pool hands the oldest such slot out again (see bRecycleUntimed).
+* - Find() is O(1) through an object -> slot map.
+* - In use slots are also kept in a dense array (swap-remove on release) so per frame work can
+*   iterate GetActiveIndices() and scale with the live objects instead of the pool capacity.
+* - Optionally bound to a FShooterTimingWheel: every slot with a lifetime (Time > 0) is scheduled
+*   on the wheel under WheelOwner. Slots carry a stamp that changes on every acquire / release /
+*   re-time, so the owner can tell a live timer from a stale one with IsTimerValid().
+* - Slots also carry a generation that changes on every release. GetHandle() gives the in use
+*   slot's FShooterPoolHandle, Resolve() / IsValidHandle() reject a handle of an earlier use.
+*
+* The pool does not touch the objects themselves, the owner resets an object and then calls
+* Release(). Pooled actors are owned by their level, the pool only keeps raw pointers.
+*/
+template<typename T, typename Policy = FShooterPoolEvictNone>
+class TShooterPool
+{
+public:
+	typedef typename Policy::KeyType KeyType;
+
+	TShooterPool()
+		: TimingWheel(NULL)
+		, WheelOwner(INDEX_NONE)
+	{
+	}
+
+	/** Schedule slot lifetimes on Wheel, expired slots come back as (InWheelOwner, Index, Stamp). */
+	void BindTimingWheel(FShooterTimingWheel* Wheel, int32 InWheelOwner)
+	{
+		TimingWheel = Wheel;
+		WheelOwner	= InWheelOwner;
+	}
+
+	void Reserve(int32 Count)
+	{
+		Items.Reserve(Count);
+		Times.Reserve(Count);
+		StartTimes.Reserve(Count);
+		Priorities.Reserve(Count);
+		Stamps.Reserve(Count);
+		Generations.Reserve(Count);
+		ActivePositions.Reserve(Count);
+		ActiveIndices.Reserve(Count);
+		IndexMapping.Reserve(Count);
+	}
+
+	/** Add an object to the pool as a free slot. */
+	int32 Add(T* Item)
+	{
+		const int32 Index = Items.Add(Item);
+
+		Times.Add(0.0f);
+		StartTimes.Add(0.0f);
+		Priorities.Add(0);
+		Stamps.Add(0);
+		Generations.Add(0);
+		ActivePositions.Add(INDEX_NONE);
+		IndexMapping.Add(Item, Index);
+
+		FreeList.AddSlot();
+		EvictionHeap.AddSlot();
+		UntimedHeap.AddSlot();
+
+		return Index;
+	}
+
+	void Empty()
+	{
+		Items.Empty();
+		Times.Empty();
+		StartTimes.Empty();
+		Priorities.Empty();
+		Stamps.Empty();
+		Generations.Empty();
+		ActivePositions.Empty();
+		ActiveIndices.Empty();
+		IndexMapping.Empty();
+		FreeList.Empty();
+		EvictionHeap.Empty();
+		UntimedHeap.Empty();
+	}
+
+	inline int32 Num() const
+	{
+		return Items.Num();
+	}
+
+	inline bool IsValidIndex(int32 Index) const
+	{
+		return Items.IsValidIndex(Index);
+	}
+
+	inline T* operator[](int32 Index) const
+	{
+		return Items[Index];
+	}
+
+	/** @return slot of Item or INDEX_NONE if it does not belong to this pool. */
+	inline int32 Find(const T* Item) const
+	{
+		const int32* Index = IndexMapping.Find(Item);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	inline bool IsInUse(int32 Index) const
+	{
+		return !FreeList.IsFree(Index);
+	}
+
+	/** @return handle of the in use slot Index, unset for INDEX_NONE or a free slot. */
+	inline FShooterPoolHandle GetHandle(int32 Index) const
+	{
+		if (!Items.IsValidIndex(Index) || FreeList.IsFree(Index))
+			return FShooterPoolHandle();
+
+		return FShooterPoolHandle(Index, Generations[Index]);
+	}
+
+	/** Handle's slot is in use and has not been released since the handle was taken. */
+	inline bool IsValidHandle(const FShooterPoolHandle& Handle) const
+	{
+		return Items.IsValidIndex(Handle.Index) && !FreeList.IsFree(Handle.Index) && Generations[Handle.Index] == Handle.Generation;
+	}
+
+	/** @return slot of Handle or INDEX_NONE when it is stale. */
+	inline int32 Resolve(const FShooterPoolHandle& Handle) const
+	{
+		return IsValidHandle(Handle) ? Handle.Index : INDEX_NONE;
+	}
+
+	inline int32 NumInUse() const
+	{
+		return FreeList.NumUsed();
+	}
+
+	inline int32 NumFree() const
+	{
+		return FreeList.Num();
+	}
+
+	/**
+	* Dense array of the in use slots, in no particular order.
+	* Releasing a slot moves the last entry into its place. Iterating backwards only survives the
+	* current slot releasing itself, iterate over a copy when other slots can be released too.
+	*/
+	inline const TArray<int32>& GetActiveIndices() const
+	{
+		return ActiveIndices;
+	}
+
+	/**
+	* Take a free slot and start its timer. When none is free and the policy recycles untimed slots,
+	* the oldest slot acquired with Time 0 is taken over, its earlier handles go stale.
+	* @return slot index or INDEX_NONE when the pool is exhausted. Use GetEvictionCandidate() to make room.
+	*/
+	int32 Acquire(float Now, float Time = 0.0f, int32 Priority = 0)
+	{
+		int32 Index = FreeList.Pop();
+
+		if (Index != INDEX_NONE)
+		{
+			ActivePositions[Index] = ActiveIndices.Add(Index);
+		}
+		else if (Policy::bRecycleUntimed && !UntimedHeap.IsEmpty())
+		{
+			Index = UntimedHeap.Top();
+			++Stamps[Index];
+			++Generations[Index];
+		}
+
+		if (Index != INDEX_NONE)
+		{
+			Times[Index]	  = Time;
+			StartTimes[Index] = Now;
+			Priorities[Index] = Priority;
+
+			OnTimingChanged(Index);
+		}
+		return Index;
+	}
+
+	/** Give the slot back. Releasing a free slot is ignored. */
+	void Release(int32 Index)
+	{
+		check(Items.IsValidIndex(Index));
+
+		if (FreeList.IsFree(Index))
+			return;
+
+		Times[Index]	  = 0.0f;
+		Priorities[Index] = 0;
+		++Stamps[Index];
+		++Generations[Index];
+
+		if (Policy::bCanEvict)
+		{
+			EvictionHeap.Remove(Index);
+		}
+
+		if (Policy::bRecycleUntimed)
+		{
+			UntimedHeap.Remove(Index);
+		}
+
+		// Swap-remove from the active array
+		const int32 Position = ActivePositions[Index];
+		const int32 Last	 = ActiveIndices.Last();
+
+		ActiveIndices[Position] = Last;
+		ActivePositions[Last]	= Position;
+		ActiveIndices.RemoveAt(ActiveIndices.Num() - 1, 1, false);
+		ActivePositions[Index]	= INDEX_NONE;
+
+		FreeList.Push(Index);
+	}
+
+	/** @return in use slot the policy would evict first or INDEX_NONE. */
+	int32 GetEvictionCandidate() const
+	{
+		if (!Policy::bCanEvict || EvictionHeap.IsEmpty())
+			return INDEX_NONE;
+
+		return EvictionHeap.Top();
+	}
+
+	inline float GetTime(int32 Index) const
+	{
+		return Times[Index];
+	}
+
+	inline float GetStartTime(int32 Index) const
+	{
+		return StartTimes[Index];
+	}
+
+	inline int32 GetPriority(int32 Index) const
+	{
+		return Priorities[Index];
+	}
+
+	void SetTime(int32 Index, float Time)
+	{
+		Times[Index] = Time;
+		OnTimingChanged(Index);
+	}
+
+	void SetTime(int32 Index, float Time, float StartTime)
+	{
+		Times[Index]	  = Time;
+		StartTimes[Index] = StartTime;
+		OnTimingChanged(Index);
+	}
+
+	void SetPriority(int32 Index, int32 Priority)
+	{
+		Priorities[Index] = Priority;
+		UpdateEvictionKey(Index);
+	}
+
+	/** Slot has a lifetime and it ran out. */
+	inline bool HasExpired(int32 Index, float Now) const
+	{
+		return Times[Index] > 0.0f && Now - StartTimes[Index] > Times[Index];
+	}
+
+	/** Timer came due for a slot that is still in use and has not been re-timed since it was scheduled. */
+	inline bool IsTimerValid(int32 Index, uint32 Stamp) const
+	{
+		return Items.IsValidIndex(Index) && !FreeList.IsFree(Index) && Stamps[Index] == Stamp;
+	}
+
+private:
+	void OnTimingChanged(int32 Index)
+	{
+		UpdateEvictionKey(Index);
+
+		if (Policy::bRecycleUntimed && !FreeList.IsFree(Index))
+		{
+			if (Times[Index] > 0.0f)
+			{
+				UntimedHeap.Remove(Index);
+			}
+			else
+			{
+				UntimedHeap.Update(Index, StartTimes[Index]);
+			}
+		}
+
+		if (TimingWheel && !FreeList.IsFree(Index))
+		{
+			// Invalidates any timer that is still on the wheel for this slot
+			++Stamps[Index];
+
+			if (Times[Index] > 0.0f)
+			{
+				TimingWheel->Schedule(WheelOwner, Index, Stamps[Index], StartTimes[Index] + Times[Index]);
+			}
+		}
+	}
+
+	void UpdateEvictionKey(int32 Index)
+	{
+		if (Policy::bCanEvict && !FreeList.IsFree(Index))
+		{
+			EvictionHeap.Update(Index, Policy::GetKey(StartTimes[Index], Times[Index], Priorities[Index]));
+		}
+	}
+
+	TArray<T*>				  Items;
+	TArray<float>			  Times;
+	TArray<float>			  StartTimes;
+	TArray<int32>			  Priorities;
+	TArray<uint32>			  Stamps;
+	/** Changes on release only, unlike Stamps which also change on re-time */
+	TArray<uint32>			  Generations;
+	TArray<int32>			  ActivePositions;
+	TArray<int32>			  ActiveIndices;
+	TMap<const T*, int32>	  IndexMapping;
+	FShooterPoolFreeList	  FreeList;
+	TShooterPoolHeap<KeyType> EvictionHeap;
+	/** In use slots without a lifetime keyed on start time, only kept when Policy::bRecycleUntimed */
+	FShooterPoolExpiryHeap	  UntimedHeap;
+	FShooterTimingWheel*	  TimingWheel;
+	int32					  WheelOwner;
+};
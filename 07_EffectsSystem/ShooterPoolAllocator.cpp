@@ -0,0 +1,155 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterPoolAllocator.h"
+
+#if !UE_BUILD_SHIPPING
+/**
+* Emitter pool workload (allocate with 0.5 - 3 second lifetimes, expire, steal the slot that lived
+* enough when full) run over the linear scans AllocateEmitter used to do and over the free list and
+* heaps it uses now. Both runs get the same lifetimes.
+*/
+static void RunPoolAllocatorBenchmark()
+{
+	const int32 PoolSizes[] = { 256, 1024, 4096 };
+	const int32 Frames		= 600;
+	const float DeltaTime	= 1.0f / 60.0f;
+	// Same ratio as TShooterPoolEvictLivedEnough<90>
+	const float LivedEnough = 0.9f;
+
+	for (int32 PoolSize : PoolSizes)
+	{
+		// About one pool's worth over an average lifetime, so the pool runs full now and then
+		const int32 AllocationsPerFrame = FMath::Max(PoolSize / 100, 1);
+		const int32 AllocationCount		= Frames * AllocationsPerFrame;
+
+		FRandomStream Random(0x5eed);
+		TArray<float> Lifetimes;
+		Lifetimes.SetNumUninitialized(AllocationCount);
+
+		for (int32 Allocation = 0; Allocation < AllocationCount; Allocation++)
+		{
+			Lifetimes[Allocation] = Random.FRandRange(0.5f, 3.0f);
+		}
+
+		// Linear: scan for an expired slot per frame, for a free slot per allocation, then for a victim
+		int32 LinearSteals = 0;
+		double StartTime   = FPlatformTime::Seconds();
+		{
+			TArray<bool> Available;
+			TArray<float> SpawnTimes;
+			TArray<float> LifeTimes;
+
+			Available.Init(true, PoolSize);
+			SpawnTimes.Init(0.0f, PoolSize);
+			LifeTimes.Init(0.0f, PoolSize);
+
+			int32 Allocation = 0;
+
+			for (int32 Frame = 0; Frame < Frames; Frame++)
+			{
+				const float Now = Frame * DeltaTime;
+
+				for (int32 Index = 0; Index < PoolSize; Index++)
+				{
+					if (!Available[Index] && Now - SpawnTimes[Index] > LifeTimes[Index])
+					{
+						Available[Index] = true;
+					}
+				}
+
+				for (int32 Count = 0; Count < AllocationsPerFrame; Count++)
+				{
+					int32 Slot = INDEX_NONE;
+
+					for (int32 Index = 0; Index < PoolSize; Index++)
+					{
+						if (Available[Index])
+						{
+							Slot = Index;
+							break;
+						}
+					}
+
+					if (Slot == INDEX_NONE)
+					{
+						float BestKey = MAX_flt;
+
+						for (int32 Index = 0; Index < PoolSize; Index++)
+						{
+							const float Key = SpawnTimes[Index] + LifeTimes[Index] * LivedEnough;
+
+							if (Key < BestKey)
+							{
+								BestKey = Key;
+								Slot	= Index;
+							}
+						}
+						LinearSteals++;
+					}
+
+					Available[Slot]	 = false;
+					SpawnTimes[Slot] = Now;
+					LifeTimes[Slot]	 = Lifetimes[Allocation++];
+				}
+			}
+		}
+		const double LinearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Frames;
+
+		// Free list: pop expired slots off the expiry heap, free slots off the list, victims off the eviction heap
+		int32 FreeListSteals = 0;
+		StartTime			 = FPlatformTime::Seconds();
+		{
+			FShooterPoolFreeList FreeList;
+			FShooterPoolExpiryHeap ExpiryHeap;
+			FShooterPoolExpiryHeap EvictionHeap;
+
+			FreeList.Init(PoolSize);
+			ExpiryHeap.Init(PoolSize);
+			EvictionHeap.Init(PoolSize);
+
+			int32 Allocation = 0;
+
+			for (int32 Frame = 0; Frame < Frames; Frame++)
+			{
+				const float Now = Frame * DeltaTime;
+
+				while (!ExpiryHeap.IsEmpty() && ExpiryHeap.GetKey(ExpiryHeap.Top()) < Now)
+				{
+					const int32 Slot = ExpiryHeap.Top();
+
+					ExpiryHeap.Remove(Slot);
+					EvictionHeap.Remove(Slot);
+					FreeList.Push(Slot);
+				}
+
+				for (int32 Count = 0; Count < AllocationsPerFrame; Count++)
+				{
+					int32 Slot = FreeList.Pop();
+
+					if (Slot == INDEX_NONE)
+					{
+						Slot = EvictionHeap.Top();
+						FreeListSteals++;
+					}
+
+					const float Lifetime = Lifetimes[Allocation++];
+
+					ExpiryHeap.Update(Slot, Now + Lifetime);
+					EvictionHeap.Update(Slot, Now + Lifetime * LivedEnough);
+				}
+			}
+		}
+		const double FreeListMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Frames;
+
+		UE_LOG(LogShooter, Log, TEXT("PoolAllocator benchmark: %4d slots, %d allocations per frame, linear %.4f ms, free list %.4f ms per frame (%.1fx), steals %d / %d"),
+			PoolSize, AllocationsPerFrame, LinearMs, FreeListMs, FreeListMs > 0.0 ? LinearMs / FreeListMs : 0.0, LinearSteals, FreeListSteals);
+	}
+}
+
+static FAutoConsoleCommand PoolAllocatorBenchmarkCommand(
+	TEXT("shooter.benchmarkpoolallocator"),
+	TEXT("Time the emitter pool's allocate / expire / steal workload at 256, 1024 and 4096 slots, linear scans against the free list and heaps."),
+	FConsoleCommandDelegate::CreateStatic(&RunPoolAllocatorBenchmark)
+	);
+#endif // #if !UE_BUILD_SHIPPING
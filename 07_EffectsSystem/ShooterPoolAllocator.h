@@ -0,0 +1,276 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* Intrusive free list over pool slot indices.
+* Pop / Push are O(1), slots are handed back in LIFO order so recently released
+* actors (which are still warm in cache) get reused first.
+*/
+struct FShooterPoolFreeList
+{
+	FShooterPoolFreeList()
+		: Head(INDEX_NONE)
+		, NumFree(0)
+	{
+	}
+
+	/** Make every slot in [0, Count) free. */
+	void Init(int32 Count)
+	{
+		NextFree.SetNumUninitialized(Count);
+		IsFreeList.SetNumUninitialized(Count);
+
+		// Build the chain backwards so that slot 0 is handed out first
+		Head = INDEX_NONE;
+		for (int32 Index = Count - 1; Index >= 0; --Index)
+		{
+			NextFree[Index]   = Head;
+			IsFreeList[Index] = true;
+			Head			  = Index;
+		}
+		NumFree = Count;
+	}
+
+	/** Append one more free slot, returns its index. */
+	int32 AddSlot()
+	{
+		const int32 Index = NextFree.Add(INDEX_NONE);
+		IsFreeList.Add(false);
+		Push(Index);
+		return Index;
+	}
+
+	void Empty()
+	{
+		NextFree.Empty();
+		IsFreeList.Empty();
+		Head	= INDEX_NONE;
+		NumFree = 0;
+	}
+
+	/** @return free slot index or INDEX_NONE when the pool is exhausted. */
+	int32 Pop()
+	{
+		const int32 Index = Head;
+
+		if (Index != INDEX_NONE)
+		{
+			Head			  = NextFree[Index];
+			NextFree[Index]   = INDEX_NONE;
+			IsFreeList[Index] = false;
+			--NumFree;
+		}
+		return Index;
+	}
+
+	/** Return slot to the list. Releasing a slot that is already free is ignored. */
+	void Push(int32 Index)
+	{
+		check(IsFreeList.IsValidIndex(Index));
+
+		if (IsFreeList[Index])
+			return;
+
+		NextFree[Index]   = Head;
+		IsFreeList[Index] = true;
+		Head			  = Index;
+		++NumFree;
+	}
+
+	inline bool IsFree(int32 Index) const
+	{
+		return IsFreeList[Index];
+	}
+
+	inline int32 Num() const
+	{
+		return NumFree;
+	}
+
+	inline int32 Capacity() const
+	{
+		return NextFree.Num();
+	}
+
+	/** Number of slots that are currently handed out. */
+	inline int32 NumUsed() const
+	{
+		return NextFree.Num() - NumFree;
+	}
+
+private:
+	TArray<int32> NextFree;
+	TArray<bool>  IsFreeList;
+	int32		  Head;
+	int32		  NumFree;
+};
+
+/**
+* Indexed binary min-heap of pool slot indices.
+* Insert / Update / Remove are O(log n), Top is O(1).
+* Slot -> heap position is tracked so an arbitrary slot can be removed when its actor
+* releases itself back to the pool.
+* KeyType only needs operator<.
+*/
+template<typename KeyType>
+struct TShooterPoolHeap
+{
+	void Init(int32 Count)
+	{
+		Heap.Reset(Count);
+		Keys.SetNum(Count);
+		HeapPositions.SetNumUninitialized(Count);
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			HeapPositions[Index] = INDEX_NONE;
+		}
+	}
+
+	/** Append one more slot that is not in the heap. */
+	void AddSlot()
+	{
+		Keys.AddDefaulted();
+		HeapPositions.Add(INDEX_NONE);
+	}
+
+	void Empty()
+	{
+		Heap.Empty();
+		Keys.Empty();
+		HeapPositions.Empty();
+	}
+
+	inline bool IsEmpty() const
+	{
+		return Heap.Num() == 0;
+	}
+
+	inline int32 Num() const
+	{
+		return Heap.Num();
+	}
+
+	inline bool Contains(int32 Index) const
+	{
+		return HeapPositions[Index] != INDEX_NONE;
+	}
+
+	/** @return slot with the smallest key. Heap must not be empty. */
+	inline int32 Top() const
+	{
+		check(Heap.Num() > 0);
+		return Heap[0];
+	}
+
+	inline const KeyType& GetKey(int32 Index) const
+	{
+		return Keys[Index];
+	}
+
+	/** @return slot at heap Position, [0, Num()) in no particular order. */
+	inline int32 GetAt(int32 Position) const
+	{
+		return Heap[Position];
+	}
+
+	/** Insert slot, or move it to its new position if it is already in the heap. */
+	void Update(int32 Index, const KeyType& Key)
+	{
+		check(HeapPositions.IsValidIndex(Index));
+
+		Keys[Index] = Key;
+
+		int32 Position = HeapPositions[Index];
+
+		if (Position == INDEX_NONE)
+		{
+			Position			 = Heap.Add(Index);
+			HeapPositions[Index] = Position;
+		}
+		SiftDown(SiftUp(Position));
+	}
+
+	/** Remove slot from the heap. Removing a slot that is not in the heap is ignored. */
+	void Remove(int32 Index)
+	{
+		const int32 Position = HeapPositions[Index];
+
+		if (Position == INDEX_NONE)
+			return;
+
+		const int32 LastPosition = Heap.Num() - 1;
+
+		if (Position != LastPosition)
+		{
+			Swap(Position, LastPosition);
+		}
+		Heap.RemoveAt(LastPosition, 1, false);
+		HeapPositions[Index] = INDEX_NONE;
+
+		if (Position < Heap.Num())
+		{
+			SiftDown(SiftUp(Position));
+		}
+	}
+
+private:
+	void Swap(int32 A, int32 B)
+	{
+		const int32 Temp = Heap[A];
+		Heap[A]			 = Heap[B];
+		Heap[B]			 = Temp;
+
+		HeapPositions[Heap[A]] = A;
+		HeapPositions[Heap[B]] = B;
+	}
+
+	int32 SiftUp(int32 Position)
+	{
+		while (Position > 0)
+		{
+			const int32 Parent = (Position - 1) / 2;
+
+			if (!(Keys[Heap[Position]] < Keys[Heap[Parent]]))
+				break;
+
+			Swap(Parent, Position);
+			Position = Parent;
+		}
+		return Position;
+	}
+
+	void SiftDown(int32 Position)
+	{
+		const int32 Count = Heap.Num();
+
+		for (;;)
+		{
+			const int32 Left	 = Position * 2 + 1;
+			const int32 Right	 = Left + 1;
+			int32		Smallest = Position;
+
+			if (Left < Count && Keys[Heap[Left]] < Keys[Heap[Smallest]])
+				Smallest = Left;
+			if (Right < Count && Keys[Heap[Right]] < Keys[Heap[Smallest]])
+				Smallest = Right;
+
+			if (Smallest == Position)
+				break;
+
+			Swap(Smallest, Position);
+			Position = Smallest;
+		}
+	}
+
+	/** Slot indices ordered as a binary heap. */
+	TArray<int32> Heap;
+	/** Per slot key (SoA, indexed by slot). */
+	TArray<KeyType> Keys;
+	/** Per slot position in Heap or INDEX_NONE. */
+	TArray<int32> HeapPositions;
+};
+
+/** Heap keyed on expected death time in world seconds. */
+typedef TShooterPoolHeap<float> FShooterPoolExpiryHeap;
@@ -0,0 +1,172 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/** One pool of FShooterPoolBuilder. */
+struct FShooterPoolBuildStage
+{
+	const TCHAR*			Name;
+	int32					Count;
+	/** Sets the pool up (reserve, parallel arrays, subsystems) before its first actor, gets Count */
+	TFunction<void(int32)>	Begin;
+	/** Spawns the pool's actor Index and adds it to the pool */
+	TFunction<void(int32)>	Spawn;
+	bool					bBegun;
+	int32					Built;
+	/** Time spent in Begin and Spawn, summed over every frame the pool was built on */
+	double					Seconds;
+	int32					Frames;
+};
+
+/**
+* Incremental construction of the game state's pools, owned by AShooterGameState.
+*
+* PostActorCreated() adds a stage per pool and the game state calls Step() every frame until
+* IsDone(): a step spawns actors in stage order until its time or actor budget is used up, so the
+* pools are spread over the first frames of a map instead of spawning in one hitch. A step always
+* spawns at least one actor, and a step without limits builds everything that is left.
+*
+* Every stage keeps the time it took, logged when it completes outside of shipping builds.
+*/
+class FShooterPoolBuilder
+{
+public:
+	FShooterPoolBuilder()
+		: StageIndex(0)
+		, StartFrame(0)
+		, Spawned(0)
+		, bStepping(false)
+	{
+	}
+
+	/** Drop every stage, pools that were partly built stay as they are. */
+	void Reset()
+	{
+		Stages.Reset();
+		StageIndex = 0;
+		StartFrame = GFrameCounter;
+		Spawned	   = 0;
+	}
+
+	void AddStage(const TCHAR* Name, int32 Count, TFunction<void(int32)> Begin, TFunction<void(int32)> Spawn)
+	{
+		if (Stages.Num() == 0)
+		{
+			StartFrame = GFrameCounter;
+		}
+
+		FShooterPoolBuildStage& Stage = Stages[Stages.AddDefaulted()];
+		Stage.Name					  = Name;
+		Stage.Count					  = FMath::Max(Count, 0);
+		Stage.Begin					  = Begin;
+		Stage.Spawn					  = Spawn;
+		Stage.bBegun				  = false;
+		Stage.Built					  = 0;
+		Stage.Seconds				  = 0.0;
+		Stage.Frames				  = 0;
+	}
+
+	/**
+	* Spawn the next actors.
+	* @param BudgetSeconds - stop once this much time was spent, <= 0 for no time limit.
+	* @param MaxSpawns - stop after this many actors, <= 0 for no count limit.
+	* @return number of actors spawned.
+	*/
+	int32 Step(double BudgetSeconds, int32 MaxSpawns)
+	{
+		TGuardValue<bool> SteppingGuard(bStepping, true);
+
+		const double StepStart = FPlatformTime::Seconds();
+		double Now			   = StepStart;
+		int32 StepSpawned	   = 0;
+		bool bOutOfBudget	   = false;
+
+		while (StageIndex < Stages.Num() && !bOutOfBudget)
+		{
+			FShooterPoolBuildStage& Stage = Stages[StageIndex];
+			const double StageStart		  = Now;
+
+			if (!Stage.bBegun)
+			{
+				Stage.bBegun = true;
+
+				if (Stage.Begin)
+				{
+					Stage.Begin(Stage.Count);
+				}
+			}
+
+			while (Stage.Built < Stage.Count && !bOutOfBudget)
+			{
+				Stage.Spawn(Stage.Built++);
+				StepSpawned++;
+
+				Now			 = FPlatformTime::Seconds();
+				bOutOfBudget = (MaxSpawns > 0 && StepSpawned >= MaxSpawns) || (BudgetSeconds > 0.0 && Now - StepStart >= BudgetSeconds);
+			}
+
+			Now			   = FPlatformTime::Seconds();
+			Stage.Seconds += Now - StageStart;
+			Stage.Frames++;
+
+			if (Stage.Built < Stage.Count)
+				break;
+
+#if !UE_BUILD_SHIPPING
+			UE_LOG(LogShooter, Log, TEXT("Pool construction: %s, %d actors in %.2f ms over %d frames"), Stage.Name, Stage.Count, Stage.Seconds * 1000.0, Stage.Frames);
+#endif // #if !UE_BUILD_SHIPPING
+
+			StageIndex++;
+		}
+
+		Spawned += StepSpawned;
+
+#if !UE_BUILD_SHIPPING
+		if (StepSpawned > 0 && IsDone())
+		{
+			UE_LOG(LogShooter, Log, TEXT("Pool construction: %d pools, %d actors in %.2f ms over %d frames"), Stages.Num(), Spawned, GetSeconds() * 1000.0, (int32)(GFrameCounter - StartFrame) + 1);
+		}
+#endif // #if !UE_BUILD_SHIPPING
+
+		return StepSpawned;
+	}
+
+	/** @return true once every stage added since Reset() is built, or when there is none. */
+	inline bool IsDone() const
+	{
+		return StageIndex >= Stages.Num();
+	}
+
+	/** @return true while Step() is spawning, an actor spawned by a stage must not step again. */
+	inline bool IsStepping() const
+	{
+		return bStepping;
+	}
+
+	/** @return time spent building, all stages. */
+	double GetSeconds() const
+	{
+		double Seconds = 0.0;
+
+		for (const FShooterPoolBuildStage& Stage : Stages)
+		{
+			Seconds += Stage.Seconds;
+		}
+		return Seconds;
+	}
+
+	inline const TArray<FShooterPoolBuildStage>& GetStages() const
+	{
+		return Stages;
+	}
+
+private:
+	TArray<FShooterPoolBuildStage>	Stages;
+	/** Stage being built */
+	int32							StageIndex;
+	/** GFrameCounter of the first stage */
+	uint64							StartFrame;
+	/** Actors spawned since Reset() */
+	int32							Spawned;
+	bool							bStepping;
+};
@@ -0,0 +1,219 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/** Pools sized by FShooterPoolStats. */
+namespace EShooterPoolStat
+{
+	enum Type
+	{
+		Actor,
+		Flipbook,
+		Emitter,
+		Sound,
+		Mesh,
+		SkeletalMesh,
+		Text,
+		EShooterPoolStat_MAX,
+	};
+}
+
+/**
+* Occupancy of the game state's pools, owned by AShooterGameState.
+*
+* Every pool records its high-water mark (most slots in use at once), its evictions (allocations
+* that stole a living slot) and its failures (allocations a pool that never steals had no slot for)
+* during a match. Save() writes them to a section per map of Saved/PoolStats.ini, Load() reads them
+* back on the next load of the map and Size() builds each pool with what the map needed plus
+* Headroom instead of a fixed count:
+*  - no stats: the default count.
+*  - stats: high-water mark, plus the evictions and failures (up to as many again) when the pool
+*    ran dry, plus Headroom, within [default / 4, default * 4].
+*
+* A saved high-water mark decays by DecayRate when a later match needs less, so one busy match
+* does not keep a map's pools large forever.
+*
+* Pools may also grow by one slot per frame at runtime (see AShooterGameState::GrowPool) up to the
+* same default * 4 limit, a pool that grew records the higher mark and starts larger next time.
+*/
+class FShooterPoolStats
+{
+public:
+	FShooterPoolStats()
+		: Headroom(0.25f)
+		, DecayRate(0.75f)
+	{
+		Reset();
+	}
+
+	/** Forget the loaded stats and this match's. */
+	void Reset()
+	{
+		for (int32 Pool = 0; Pool < EShooterPoolStat::EShooterPoolStat_MAX; Pool++)
+		{
+			Capacities[Pool]	   = 0;
+			MaxCapacities[Pool]	   = 0;
+			HighWaters[Pool]	   = 0;
+			Evictions[Pool]		   = 0;
+			Failures[Pool]		   = 0;
+			Grows[Pool]			   = 0;
+			GrowFrames[Pool]	   = MAX_uint64;
+			bLoaded[Pool]		   = false;
+			LoadedHighWaters[Pool] = 0;
+			LoadedEvictions[Pool]  = 0;
+			LoadedFailures[Pool]   = 0;
+		}
+	}
+
+	/** Read MapName's stats, pools without any keep their default count. */
+	void Load(const FString& MapName)
+	{
+		Reset();
+
+		const FString Filename = GetFilename();
+
+		for (int32 Pool = 0; Pool < EShooterPoolStat::EShooterPoolStat_MAX; Pool++)
+		{
+			int32 HighWater = 0;
+			int32 Eviction	= 0;
+			int32 Failure	= 0;
+
+			if (!GConfig->GetInt(*MapName, *GetKey(Pool, TEXT("HighWater")), HighWater, Filename))
+				continue;
+
+			GConfig->GetInt(*MapName, *GetKey(Pool, TEXT("Evictions")), Eviction, Filename);
+			GConfig->GetInt(*MapName, *GetKey(Pool, TEXT("Failures")), Failure, Filename);
+
+			bLoaded[Pool]		   = true;
+			LoadedHighWaters[Pool] = FMath::Max(HighWater, 0);
+			LoadedEvictions[Pool]  = FMath::Max(Eviction, 0);
+			LoadedFailures[Pool]   = FMath::Max(Failure, 0);
+		}
+	}
+
+	/** Write this match's stats of every pool that was built as MapName's. */
+	void Save(const FString& MapName) const
+	{
+		const FString Filename = GetFilename();
+
+		for (int32 Pool = 0; Pool < EShooterPoolStat::EShooterPoolStat_MAX; Pool++)
+		{
+			// Not built on this machine (lean dedicated server)
+			if (Capacities[Pool] == 0)
+				continue;
+
+			const int32 HighWater = FMath::Max(HighWaters[Pool], FMath::FloorToInt(LoadedHighWaters[Pool] * DecayRate));
+
+			GConfig->SetInt(*MapName, *GetKey(Pool, TEXT("HighWater")), HighWater, Filename);
+			GConfig->SetInt(*MapName, *GetKey(Pool, TEXT("Evictions")), Evictions[Pool], Filename);
+			GConfig->SetInt(*MapName, *GetKey(Pool, TEXT("Failures")), Failures[Pool], Filename);
+
+#if !UE_BUILD_SHIPPING
+			UE_LOG(LogShooter, Log, TEXT("Pool stats: %s %s, capacity %d, high water %d, evictions %d, failures %d, grown %d"), *MapName, GetName(Pool), Capacities[Pool], HighWaters[Pool], Evictions[Pool], Failures[Pool], Grows[Pool]);
+#endif // #if !UE_BUILD_SHIPPING
+		}
+
+		GConfig->Flush(false, Filename);
+	}
+
+	/**
+	* Count to build Pool with, recorded as its capacity.
+	* @param Floor - build at least this many whatever the stats say.
+	*/
+	int32 Size(uint8 Pool, int32 Default, int32 Floor = 0)
+	{
+		check(Pool < EShooterPoolStat::EShooterPoolStat_MAX);
+
+		int32 Count = Default;
+
+		if (bLoaded[Pool])
+		{
+			const int32 Need = LoadedHighWaters[Pool] + FMath::Min(LoadedEvictions[Pool] + LoadedFailures[Pool], LoadedHighWaters[Pool]);
+
+			Count = FMath::Clamp(FMath::CeilToInt(Need * (1.0f + Headroom)), FMath::Max(Default / 4, 1), Default * 4);
+		}
+
+		Capacities[Pool]	= FMath::Max(Count, Floor);
+		MaxCapacities[Pool] = FMath::Max(Default * 4, Capacities[Pool]);
+
+		return Capacities[Pool];
+	}
+
+	inline void NoteInUse(uint8 Pool, int32 InUse)
+	{
+		HighWaters[Pool] = FMath::Max(HighWaters[Pool], InUse);
+	}
+
+	inline void NoteEviction(uint8 Pool)
+	{
+		Evictions[Pool]++;
+	}
+
+	inline void NoteFailure(uint8 Pool)
+	{
+		Failures[Pool]++;
+	}
+
+	/** @return whether Pool may grow by a slot on Frame, one slot per pool per frame. */
+	inline bool CanGrow(uint8 Pool, uint64 Frame) const
+	{
+		return Capacities[Pool] > 0 && Capacities[Pool] < MaxCapacities[Pool] && GrowFrames[Pool] != Frame;
+	}
+
+	/** @return index of the slot Pool grows by on Frame. */
+	inline int32 NoteGrow(uint8 Pool, uint64 Frame)
+	{
+		GrowFrames[Pool] = Frame;
+		Grows[Pool]++;
+
+		return Capacities[Pool]++;
+	}
+
+	static const TCHAR* GetName(uint8 Pool)
+	{
+		static const TCHAR* Names[EShooterPoolStat::EShooterPoolStat_MAX] =
+		{
+			TEXT("Actor"),
+			TEXT("Flipbook"),
+			TEXT("Emitter"),
+			TEXT("Sound"),
+			TEXT("Mesh"),
+			TEXT("SkeletalMesh"),
+			TEXT("Text"),
+		};
+
+		check(Pool < EShooterPoolStat::EShooterPoolStat_MAX);
+		return Names[Pool];
+	}
+
+	static FString GetFilename()
+	{
+		return FPaths::GameSavedDir() / TEXT("PoolStats.ini");
+	}
+
+	/** Share of its size a pool is built with on top of the recorded need */
+	float						Headroom;
+	/** Share of a saved high-water mark kept when a later match needs less */
+	float						DecayRate;
+
+private:
+	static FString GetKey(uint8 Pool, const TCHAR* Field)
+	{
+		return FString::Printf(TEXT("%s.%s"), GetName(Pool), Field);
+	}
+
+	/** Slots built, including the ones grown at runtime */
+	int32						Capacities[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						MaxCapacities[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						HighWaters[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						Evictions[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						Failures[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						Grows[EShooterPoolStat::EShooterPoolStat_MAX];
+	/** GFrameCounter of the last grow */
+	uint64						GrowFrames[EShooterPoolStat::EShooterPoolStat_MAX];
+
+	bool						bLoaded[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						LoadedHighWaters[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						LoadedEvictions[EShooterPoolStat::EShooterPoolStat_MAX];
+	int32						LoadedFailures[EShooterPoolStat::EShooterPoolStat_MAX];
+};
@@ -0,0 +1,235 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterPoolTasks.h"
+#include "ShooterSignificance.h"
+
+void FShooterPoolTasks::BuildMeshCommands(const TArray<FShooterMeshTaskInput>& Inputs, float DeltaSeconds, bool bParallel, TArray<FShooterPoolCommand>& OutCommands)
+{
+	OutCommands.SetNumUninitialized(Inputs.Num());
+
+	ForEachChunk(Inputs.Num(), bParallel, [&Inputs, &OutCommands, DeltaSeconds](int32 Begin, int32 End)
+	{
+		for (int32 Position = Begin; Position < End; Position++)
+		{
+			const FShooterMeshTaskInput& Input = Inputs[Position];
+			FShooterPoolCommand& Command	   = OutCommands[Position];
+
+			Command.Index	  = Input.Index;
+			Command.Flags	  = EShooterPoolCommand::None;
+			Command.bHidden	  = Input.bHidden;
+			Command.WorldSize = 0.0f;
+			Command.Scale	  = FVector(1.0f);
+			Command.Rotation  = FRotator::ZeroRotator;
+
+			const bool HideMesh = Input.DistanceSq > Input.DrawDistanceSq;
+
+			if (Input.bHasOwner)
+			{
+				const float Distance = FVector::Dist(Input.Location, Input.OwnerEyeLocation);
+
+				// Hit Marker
+				if (Input.Type == EMeshPoolType::HitMarker)
+				{
+					const float Scale = Input.bTankHitMarker ? 0.006f : 0.004f;
+
+					Command.Flags	 = EShooterPoolCommand::SetScale | EShooterPoolCommand::SetRotation;
+					Command.Scale	 = Scale * Distance * FVector(2.0f, 1.0f, 1.0f);
+					Command.Rotation = FRotator(Input.OwnerViewRotation.Pitch, Input.OwnerViewRotation.Yaw, 45.0f);
+					continue;
+				}
+				// Kill Confirmed Icon - TODO: Remove. No longer used
+				if (Input.Type == EMeshPoolType::KillConfirmedIcon)
+				{
+					const FQuat Spin = FQuat(DeltaSeconds * FRotator(0.0f, 100.0f, 0.0f));
+
+					Command.Flags	 = EShooterPoolCommand::SetScale | EShooterPoolCommand::SetRotation;
+					Command.Scale	 = 0.0035f * Distance * FVector(1.0f);
+					Command.Rotation = (Input.Rotation * Spin).Rotator();
+					continue;
+				}
+				// Medal
+				if (Input.Type == EMeshPoolType::Medal)
+				{
+					Command.Flags	 = EShooterPoolCommand::SetScale | EShooterPoolCommand::SetRotation;
+					Command.Scale	 = 0.0005f * Distance * FVector(1.0f);
+					Command.Rotation = FRotator(0.0f, Input.OwnerViewRotation.Yaw + 90.0f, 0.0f);
+					continue;
+				}
+			}
+
+			if (Input.bHidden != HideMesh)
+			{
+				Command.Flags	= EShooterPoolCommand::SetHidden;
+				Command.bHidden = HideMesh;
+			}
+		}
+	});
+}
+
+void FShooterPoolTasks::BuildTextCommands(const TArray<FShooterTextTaskInput>& Inputs, const FRotator& ViewRotation, bool bParallel, TArray<FShooterPoolCommand>& OutCommands)
+{
+	OutCommands.SetNumUninitialized(Inputs.Num());
+
+	const FRotator FacingRotation = FRotator(-1.0f * ViewRotation.Pitch, ViewRotation.Yaw + 180.0f, 0.0f);
+
+	ForEachChunk(Inputs.Num(), bParallel, [&Inputs, &OutCommands, &FacingRotation](int32 Begin, int32 End)
+	{
+		for (int32 Position = Begin; Position < End; Position++)
+		{
+			const FShooterTextTaskInput& Input = Inputs[Position];
+			FShooterPoolCommand& Command	   = OutCommands[Position];
+
+			Command.Index	  = Input.Index;
+			Command.Flags	  = EShooterPoolCommand::None;
+			Command.bHidden	  = false;
+			Command.WorldSize = 0.0f;
+			Command.Scale	  = FVector(1.0f);
+			Command.Rotation  = FRotator::ZeroRotator;
+
+			float Scale = 0.1f;
+
+			switch (Input.Type)
+			{
+				case ETextType::KilledPlayer:
+				case ETextType::KilledTank:
+					Scale = 0.1f;
+					break;
+				case ETextType::HitPlayer:
+				case ETextType::HitTank:
+					Scale = 0.05f;
+					break;
+				default:
+					continue;
+			}
+
+			Command.Flags	  = EShooterPoolCommand::SetWorldSize | EShooterPoolCommand::SetRotation;
+			Command.WorldSize = Scale * FMath::Sqrt(Input.DistanceSq);
+			Command.Rotation  = FacingRotation;
+		}
+	});
+}
+
+#if !UE_BUILD_SHIPPING
+void FShooterPoolTasks::RunValidation()
+{
+	const int32 SlotCount = 4000;
+	int32 Errors		  = 0;
+
+	FRandomStream Random(0x7A5C);
+
+	auto RandomLocation = [&Random]()
+	{
+		return FVector(Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(-2000.0f, 2000.0f));
+	};
+
+	// Significance
+	FShooterViewContext View;
+	View.Frame = 1;
+	View.SetView(RandomLocation(), FRotator(Random.FRandRange(-60.0f, 60.0f), Random.FRandRange(-180.0f, 180.0f), 0.0f), 90.0f, FVector2D(1920.0f, 1080.0f));
+
+	auto ResolveSignificance = [&View, SlotCount](FShooterSignificance& Significance, bool bParallel)
+	{
+		// Same stream for both runs so both get the same slots
+		FRandomStream SlotRandom(0x51C);
+
+		Significance.BeginFrame(View);
+
+		for (int32 Index = 0; Index < SlotCount; Index++)
+		{
+			const uint8 Pool		 = (uint8)SlotRandom.RandHelper(EShooterSignificancePool::EShooterSignificancePool_MAX);
+			const float DrawDistance = SlotRandom.FRand() < 0.3f ? 0.0f : SlotRandom.FRandRange(1000.0f, 15000.0f);
+			const FVector Location	 = FVector(SlotRandom.FRandRange(-20000.0f, 20000.0f), SlotRandom.FRandRange(-20000.0f, 20000.0f), SlotRandom.FRandRange(-2000.0f, 2000.0f));
+
+			Significance.Add(Pool, Index, Location, DrawDistance * DrawDistance, SlotRandom.FRand() < 0.05f);
+		}
+
+		Significance.Resolve(bParallel);
+	};
+
+	FShooterSignificance Serial;
+	FShooterSignificance Parallel;
+
+	ResolveSignificance(Serial, false);
+	ResolveSignificance(Parallel, true);
+
+	for (uint8 Pool = 0; Pool < EShooterSignificancePool::EShooterSignificancePool_MAX; Pool++)
+	{
+		for (int32 Index = 0; Index < SlotCount; Index++)
+		{
+			if (Serial.ShouldUpdate(Pool, Index) != Parallel.ShouldUpdate(Pool, Index) ||
+				Serial.GetTier(Pool, Index) != Parallel.GetTier(Pool, Index) ||
+				Serial.GetDistanceSq(Pool, Index) != Parallel.GetDistanceSq(Pool, Index))
+			{
+				UE_LOG(LogShooter, Warning, TEXT("PoolTasks validation: significance of pool %d slot %d differs between serial and parallel"), Pool, Index);
+				Errors++;
+			}
+		}
+	}
+
+	// Mesh
+	TArray<FShooterMeshTaskInput> MeshInputs;
+
+	for (int32 Index = 0; Index < SlotCount; Index++)
+	{
+		FShooterMeshTaskInput& Input = MeshInputs[MeshInputs.AddDefaulted()];
+		Input.Index					 = Index;
+		Input.Type					 = (uint8)Random.RandHelper(EMeshPoolType::EMeshPoolType_MAX);
+		Input.bTankHitMarker		 = Random.FRand() < 0.5f;
+		Input.bHasOwner				 = Random.FRand() < 0.5f;
+		Input.bHidden				 = Random.FRand() < 0.5f;
+		Input.Location				 = RandomLocation();
+		Input.Rotation				 = FQuat(FRotator(0.0f, Random.FRandRange(-180.0f, 180.0f), 0.0f));
+		Input.OwnerEyeLocation		 = RandomLocation();
+		Input.OwnerViewRotation		 = FRotator(Random.FRandRange(-60.0f, 60.0f), Random.FRandRange(-180.0f, 180.0f), 0.0f);
+		Input.DistanceSq			 = FVector::DistSquared(Input.Location, View.Location);
+		Input.DrawDistanceSq		 = FMath::Square(Random.FRandRange(1000.0f, 15000.0f));
+	}
+
+	TArray<FShooterPoolCommand> SerialCommands;
+	TArray<FShooterPoolCommand> ParallelCommands;
+
+	BuildMeshCommands(MeshInputs, 1.0f / 60.0f, false, SerialCommands);
+	BuildMeshCommands(MeshInputs, 1.0f / 60.0f, true, ParallelCommands);
+
+	for (int32 Position = 0; Position < SlotCount; Position++)
+	{
+		if (!(SerialCommands[Position] == ParallelCommands[Position]))
+		{
+			UE_LOG(LogShooter, Warning, TEXT("PoolTasks validation: mesh command of slot %d differs between serial and parallel"), MeshInputs[Position].Index);
+			Errors++;
+		}
+	}
+
+	// Text
+	TArray<FShooterTextTaskInput> TextInputs;
+
+	for (int32 Index = 0; Index < SlotCount; Index++)
+	{
+		FShooterTextTaskInput& Input = TextInputs[TextInputs.AddDefaulted()];
+		Input.Index					 = Index;
+		Input.Type					 = (uint8)Random.RandHelper(ETextType::ETextType_MAX);
+		Input.DistanceSq			 = FVector::DistSquared(RandomLocation(), View.Location);
+	}
+
+	BuildTextCommands(TextInputs, View.Rotation, false, SerialCommands);
+	BuildTextCommands(TextInputs, View.Rotation, true, ParallelCommands);
+
+	for (int32 Position = 0; Position < SlotCount; Position++)
+	{
+		if (!(SerialCommands[Position] == ParallelCommands[Position]))
+		{
+			UE_LOG(LogShooter, Warning, TEXT("PoolTasks validation: text command of slot %d differs between serial and parallel"), TextInputs[Position].Index);
+			Errors++;
+		}
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("PoolTasks validation: %d slots per pool, %d errors"), SlotCount, Errors);
+}
+
+static FAutoConsoleCommand PoolTasksValidationCommand(
+	TEXT("shooter.validatepooltasks"),
+	TEXT("Run the pool handlers' read phases serial and parallel over the same random pools and log any slot they disagree on."),
+	FConsoleCommandDelegate::CreateStatic(&FShooterPoolTasks::RunValidation)
+	);
+#endif // #if !UE_BUILD_SHIPPING
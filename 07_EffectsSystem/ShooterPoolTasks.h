@@ -0,0 +1,118 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Async/ParallelFor.h"
+
+/** What the apply pass does to a pool slot, flags of FShooterPoolCommand. */
+namespace EShooterPoolCommand
+{
+	enum Type
+	{
+		None		 = 0,
+		SetHidden	 = 1 << 0,
+		SetScale	 = 1 << 1,
+		SetRotation	 = 1 << 2,
+		SetWorldSize = 1 << 3,
+	};
+}
+
+/** Mesh pool slot as the read phase sees it, gathered on the game thread. */
+struct FShooterMeshTaskInput
+{
+	int32		Index;
+	/** EMeshPoolType, only read with an owner */
+	uint8		Type;
+	bool		bTankHitMarker;
+	bool		bHasOwner;
+	bool		bHidden;
+	FVector		Location;
+	FQuat		Rotation;
+	FVector		OwnerEyeLocation;
+	FRotator	OwnerViewRotation;
+	float		DistanceSq;
+	float		DrawDistanceSq;
+};
+
+/** Text pool slot as the read phase sees it, gathered on the game thread. */
+struct FShooterTextTaskInput
+{
+	int32		Index;
+	/** ETextType */
+	uint8		Type;
+	float		DistanceSq;
+};
+
+/** Mutations of one pool slot, written by a read phase and applied on the game thread. */
+struct FShooterPoolCommand
+{
+	int32		Index;
+	/** EShooterPoolCommand flags */
+	uint8		Flags;
+	bool		bHidden;
+	float		WorldSize;
+	FVector		Scale;
+	FRotator	Rotation;
+
+	/** Exact, a read phase must give the same bits however it was split over threads. */
+	inline bool operator==(const FShooterPoolCommand& Other) const
+	{
+		return Index == Other.Index &&
+			   Flags == Other.Flags &&
+			   bHidden == Other.bHidden &&
+			   WorldSize == Other.WorldSize &&
+			   Scale == Other.Scale &&
+			   Rotation == Other.Rotation;
+	}
+};
+
+/**
+* Read phases of the game state's pool handlers.
+*
+* A handler gathers what it needs from its UObjects on the game thread, the read phase then turns
+* every gathered slot into one command at the same position: no UObject is touched and no state is
+* shared between slots, so chunks run on the task graph in any order and give the same commands as
+* a serial run. The handler applies the commands on the game thread afterwards.
+*/
+class FShooterPoolTasks
+{
+public:
+	enum
+	{
+		/** Slots per task, smaller batches cost more to schedule than to run */
+		CHUNK_SIZE = 128,
+	};
+
+	/** Run Body(Begin, End) over [0, Count) in CHUNK_SIZE chunks, on the task graph when bParallel. */
+	template<typename BodyType>
+	static void ForEachChunk(int32 Count, bool bParallel, const BodyType& Body)
+	{
+		if (Count <= 0)
+			return;
+
+		const int32 ChunkCount = FMath::DivideAndRoundUp(Count, (int32)CHUNK_SIZE);
+
+		if (!bParallel || ChunkCount == 1)
+		{
+			Body(0, Count);
+			return;
+		}
+
+		ParallelFor(ChunkCount, [Count, &Body](int32 Chunk)
+		{
+			const int32 Begin = Chunk * CHUNK_SIZE;
+			Body(Begin, FMath::Min(Begin + CHUNK_SIZE, Count));
+		});
+	}
+
+	/** Visibility, scale and rotation of every gathered mesh slot. */
+	static void BuildMeshCommands(const TArray<FShooterMeshTaskInput>& Inputs, float DeltaSeconds, bool bParallel, TArray<FShooterPoolCommand>& OutCommands);
+
+	/** World size and rotation of every gathered text slot, facing ViewRotation. */
+	static void BuildTextCommands(const TArray<FShooterTextTaskInput>& Inputs, const FRotator& ViewRotation, bool bParallel, TArray<FShooterPoolCommand>& OutCommands);
+
+#if !UE_BUILD_SHIPPING
+	/** Run every read phase serial and parallel over the same random pools and log every slot they disagree on. */
+	static void RunValidation();
+#endif // #if !UE_BUILD_SHIPPING
+};
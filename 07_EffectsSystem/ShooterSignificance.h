@@ -0,0 +1,205 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterViewContext.h"
+#include "ShooterPoolTasks.h"
+
+/** Update rate of a pooled object, from most to least significant. */
+namespace EShooterSignificanceTier
+{
+	enum Type
+	{
+		EveryFrame,
+		EveryFourthFrame,
+		/** Only housekeeping (owner gone, parent gone) every DORMANT_INTERVAL frames */
+		Dormant,
+		EShooterSignificanceTier_MAX,
+	};
+}
+
+/** Pools whose objects are tiered by FShooterSignificance. */
+namespace EShooterSignificancePool
+{
+	enum Type
+	{
+		Emitter,
+		Mesh,
+		SkeletalMesh,
+		Text,
+		EShooterSignificancePool_MAX,
+	};
+}
+
+/** Pool slot waiting for FShooterSignificance::Resolve(). */
+struct FShooterSignificanceInput
+{
+	uint8	Pool;
+	bool	bOwnerRelevant;
+	int32	Index;
+	FVector	Location;
+	float	DrawDistanceSq;
+};
+
+/**
+* Significance of the game state's pooled objects, owned by AShooterGameState.
+*
+* The frame's view context is set in BeginFrame(), every in use pool slot is added with what the
+* game thread knows of it, then Resolve() gives every slot its squared distance to the view and a
+* tier in one pass, over the task graph when asked to:
+*  - EveryFrame: no view, owned by the local player, or within NearDistance.
+*  - Dormant: past its draw distance or out of the view frustum, nothing of it is on screen.
+*  - EveryFourthFrame: everything else, on screen but far.
+*
+* Pool handlers use the stored distance instead of looking the local controller up per object and
+* skip a slot on the frames its tier does not update. Slots of a tier are spread over the frames by
+* their index so a crowd of far objects does not update on the same frame. A slot allocated after
+* this frame's pass has no significance yet and is left alone until the next one.
+*/
+class FShooterSignificance
+{
+public:
+	enum
+	{
+		EVERY_FOURTH_INTERVAL = 4,
+		DORMANT_INTERVAL	  = 16,
+	};
+
+	FShooterSignificance()
+		: NearDistance(2000.0f)
+		, OnScreenRadius(500.0f)
+		, Frame(0)
+		, View(NULL)
+	{
+		FMemory::Memzero(TierCounts);
+	}
+
+	/** @param InView - must outlive the frame's Resolve() / ShouldUpdate() calls. */
+	void BeginFrame(const FShooterViewContext& InView)
+	{
+		Frame = InView.Frame;
+		View  = &InView;
+
+		Inputs.Reset();
+		FMemory::Memzero(TierCounts);
+	}
+
+	/**
+	* Add Pool's slot Index to this frame's Resolve().
+	* @param DrawDistanceSq - squared draw distance, 0 when the object is drawn at any distance.
+	* @param bOwnerRelevant - owned by or shown to the local player, always updated every frame.
+	*/
+	void Add(uint8 Pool, int32 Index, const FVector& Location, float DrawDistanceSq, bool bOwnerRelevant)
+	{
+		check(Pool < EShooterSignificancePool::EShooterSignificancePool_MAX);
+
+		if (Index >= Tiers[Pool].Num())
+		{
+			Tiers[Pool].SetNumZeroed(Index + 1);
+			DistanceSqs[Pool].SetNumZeroed(Index + 1);
+
+			while (UpdateFrames[Pool].Num() <= Index)
+			{
+				UpdateFrames[Pool].Add(MAX_uint64);
+			}
+		}
+
+		FShooterSignificanceInput& Input = Inputs[Inputs.AddUninitialized()];
+		Input.Pool						 = Pool;
+		Input.bOwnerRelevant			 = bOwnerRelevant;
+		Input.Index						 = Index;
+		Input.Location					 = Location;
+		Input.DrawDistanceSq			 = DrawDistanceSq;
+	}
+
+	/** Tier every slot added this frame. Slots only write their own entries, chunks run in any order. */
+	void Resolve(bool bParallel)
+	{
+		check(View);
+
+		FShooterPoolTasks::ForEachChunk(Inputs.Num(), bParallel, [this](int32 Begin, int32 End)
+		{
+			for (int32 Position = Begin; Position < End; Position++)
+			{
+				const FShooterSignificanceInput& Input = Inputs[Position];
+
+				float DistanceSq;
+				const uint8 Tier = ComputeTier(Input, DistanceSq);
+
+				Tiers[Input.Pool][Input.Index]		  = Tier;
+				DistanceSqs[Input.Pool][Input.Index]  = DistanceSq;
+				UpdateFrames[Input.Pool][Input.Index] = Frame;
+			}
+		});
+
+		const int32 Count = Inputs.Num();
+
+		for (int32 Position = 0; Position < Count; Position++)
+		{
+			TierCounts[Tiers[Inputs[Position].Pool][Inputs[Position].Index]]++;
+		}
+	}
+
+	inline uint8 GetTier(uint8 Pool, int32 Index) const
+	{
+		return Tiers[Pool].IsValidIndex(Index) ? Tiers[Pool][Index] : (uint8)EShooterSignificanceTier::EveryFrame;
+	}
+
+	/** @return squared distance of Pool's slot Index to the view, 0 without a view. */
+	inline float GetDistanceSq(uint8 Pool, int32 Index) const
+	{
+		return DistanceSqs[Pool].IsValidIndex(Index) ? DistanceSqs[Pool][Index] : 0.0f;
+	}
+
+	/** @return whether Pool's slot Index updates this frame. */
+	inline bool ShouldUpdate(uint8 Pool, int32 Index) const
+	{
+		if (!UpdateFrames[Pool].IsValidIndex(Index) || UpdateFrames[Pool][Index] != Frame)
+			return false;
+
+		switch (Tiers[Pool][Index])
+		{
+			case EShooterSignificanceTier::EveryFourthFrame:
+				return (Frame + Index) % EVERY_FOURTH_INTERVAL == 0;
+			case EShooterSignificanceTier::Dormant:
+				return (Frame + Index) % DORMANT_INTERVAL == 0;
+			default:
+				return true;
+		}
+	}
+
+	/** Slots given Tier this frame, all pools. */
+	inline int32 GetTierCount(uint8 Tier) const
+	{
+		return TierCounts[Tier];
+	}
+
+	/** Closer than this (units) an object updates every frame wherever it is. */
+	float						NearDistance;
+	/** Radius an object is assumed to have when testing it against the view frustum */
+	float						OnScreenRadius;
+
+private:
+	uint8 ComputeTier(const FShooterSignificanceInput& Input, float& OutDistanceSq) const
+	{
+		OutDistanceSq = View->GetDistanceSq(Input.Location);
+
+		if (!View->bHasView || Input.bOwnerRelevant || OutDistanceSq <= NearDistance * NearDistance)
+			return EShooterSignificanceTier::EveryFrame;
+
+		const bool bPastDrawDistance = Input.DrawDistanceSq > 0.0f && OutDistanceSq > Input.DrawDistanceSq;
+
+		return bPastDrawDistance || !View->IsInFrustum(Input.Location, OnScreenRadius) ? EShooterSignificanceTier::Dormant : EShooterSignificanceTier::EveryFourthFrame;
+	}
+
+	uint64						Frame;
+	const FShooterViewContext*	View;
+
+	TArray<uint8>				Tiers[EShooterSignificancePool::EShooterSignificancePool_MAX];
+	TArray<float>				DistanceSqs[EShooterSignificancePool::EShooterSignificancePool_MAX];
+	/** Frame the slot was last given a tier */
+	TArray<uint64>				UpdateFrames[EShooterSignificancePool::EShooterSignificancePool_MAX];
+	int32						TierCounts[EShooterSignificanceTier::EShooterSignificanceTier_MAX];
+
+	TArray<FShooterSignificanceInput> Inputs;
+};
@@ -0,0 +1,207 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+* Entry in FShooterTimingWheel.
+* Owner / Index identify a pool slot, Stamp is the slot's stamp when it was scheduled.
+* Entries are never removed when a slot is re-timed or released, the owner bumps the slot stamp
+* instead and stale entries are dropped when they come due.
+*/
+struct FShooterTimingWheelEntry
+{
+	int32  Owner;
+	int32  Index;
+	uint32 Stamp;
+	uint64 ExpireTick;
+};
+
+/**
+* Hierarchical timing wheel for pooled object lifetimes.
+*
+* 4 levels of 64 buckets. Level 0 has one bucket per tick (Resolution seconds), every level above
+* covers 64 times the span of the one below: at 60 ticks per second that is ~1 sec, ~68 sec,
+* ~73 min and ~78 hours. Schedule() is O(1), Advance() only touches the buckets that come due
+* plus the entries cascading down a level, so an idle wheel costs next to nothing.
+*/
+class FShooterTimingWheel
+{
+public:
+	enum
+	{
+		LEVEL_BITS  = 6,
+		LEVEL_SIZE  = 1 << LEVEL_BITS,
+		LEVEL_MASK  = LEVEL_SIZE - 1,
+		LEVEL_COUNT = 4,
+	};
+
+	FShooterTimingWheel()
+		: Resolution(1.0f / 60.0f)
+		, CurrentTick(0)
+		, NumEntries(0)
+		, bInitialized(false)
+	{
+	}
+
+	void Init(float Now, float InResolution = 1.0f / 60.0f)
+	{
+		Empty();
+
+		Resolution   = InResolution;
+		CurrentTick  = TimeToTick(Now);
+		bInitialized = true;
+	}
+
+	void Empty()
+	{
+		for (int32 Level = 0; Level < LEVEL_COUNT; ++Level)
+		{
+			for (int32 Bucket = 0; Bucket < LEVEL_SIZE; ++Bucket)
+			{
+				Buckets[Level][Bucket].Reset();
+			}
+		}
+		NumEntries   = 0;
+		bInitialized = false;
+	}
+
+	inline bool IsInitialized() const
+	{
+		return bInitialized;
+	}
+
+	/** Number of scheduled entries including stale ones. */
+	inline int32 Num() const
+	{
+		return NumEntries;
+	}
+
+	/** Schedule Owner / Index to come due at ExpireTime (world seconds). */
+	void Schedule(int32 Owner, int32 Index, uint32 Stamp, float ExpireTime)
+	{
+		check(bInitialized);
+
+		FShooterTimingWheelEntry Entry;
+		Entry.Owner		 = Owner;
+		Entry.Index		 = Index;
+		Entry.Stamp		 = Stamp;
+		Entry.ExpireTick = TimeToTickCeil(ExpireTime);
+
+		// The current tick was already processed, the earliest it can fire is the next one
+		Insert(Entry, CurrentTick + 1);
+		++NumEntries;
+	}
+
+	/**
+	* Move the wheel to Now and call OnExpired(Owner, Index, Stamp) for every entry that came due.
+	* OnExpired is allowed to Schedule() new entries.
+	* @return number of entries handed to OnExpired.
+	*/
+	template<typename FuncType>
+	int32 Advance(float Now, FuncType OnExpired)
+	{
+		if (!bInitialized)
+			return 0;
+
+		const uint64 TargetTick = TimeToTick(Now);
+		int32 Processed			= 0;
+
+		while (CurrentTick < TargetTick)
+		{
+			++CurrentTick;
+
+			// Cascade higher levels down when the level below wraps around
+			for (int32 Level = 1; Level < LEVEL_COUNT; ++Level)
+			{
+				if ((CurrentTick & ((uint64(1) << (LEVEL_BITS * Level)) - 1)) != 0)
+					break;
+
+				Cascade(Level, int32((CurrentTick >> (LEVEL_BITS * Level)) & LEVEL_MASK));
+			}
+
+			TArray<FShooterTimingWheelEntry>& Bucket = Buckets[0][CurrentTick & LEVEL_MASK];
+
+			if (Bucket.Num() == 0)
+				continue;
+
+			// Swap out the bucket so callbacks can safely schedule into it
+			Expiring.Reset();
+			Swap(Expiring, Bucket);
+
+			const int32 Count = Expiring.Num();
+			NumEntries		 -= Count;
+
+			for (int32 I = 0; I < Count; ++I)
+			{
+				const FShooterTimingWheelEntry& Entry = Expiring[I];
+				OnExpired(Entry.Owner, Entry.Index, Entry.Stamp);
+			}
+			Processed += Count;
+		}
+		return Processed;
+	}
+
+private:
+	inline uint64 TimeToTick(float Time) const
+	{
+		return Time > 0.0f ? uint64(FMath::FloorToDouble(double(Time) / Resolution)) : 0;
+	}
+
+	inline uint64 TimeToTickCeil(float Time) const
+	{
+		return Time > 0.0f ? uint64(FMath::CeilToDouble(double(Time) / Resolution)) : 0;
+	}
+
+	void Insert(const FShooterTimingWheelEntry& Entry, uint64 MinTick)
+	{
+		const uint64 ExpireTick = FMath::Max(Entry.ExpireTick, MinTick);
+		const uint64 Delta		= ExpireTick - CurrentTick;
+
+		int32 Level = 0;
+
+		while (Level < LEVEL_COUNT - 1 && Delta >= (uint64(1) << (LEVEL_BITS * (Level + 1))))
+		{
+			++Level;
+		}
+
+		// Past the top level span, park it in the furthest top bucket. It gets re-inserted on cascade.
+		uint64 Tick = ExpireTick;
+
+		if (Level == LEVEL_COUNT - 1 && Delta >= (uint64(1) << (LEVEL_BITS * LEVEL_COUNT)))
+		{
+			Tick = CurrentTick + (uint64(1) << (LEVEL_BITS * LEVEL_COUNT)) - 1;
+		}
+
+		Buckets[Level][(Tick >> (LEVEL_BITS * Level)) & LEVEL_MASK].Add(Entry);
+	}
+
+	void Cascade(int32 Level, int32 BucketIndex)
+	{
+		TArray<FShooterTimingWheelEntry>& Bucket = Buckets[Level][BucketIndex];
+
+		if (Bucket.Num() == 0)
+			return;
+
+		Cascading.Reset();
+		Swap(Cascading, Bucket);
+
+		const int32 Count = Cascading.Num();
+
+		// Cascades run before the current tick's level 0 bucket, so entries due now still fire this tick
+		for (int32 I = 0; I < Count; ++I)
+		{
+			Insert(Cascading[I], CurrentTick);
+		}
+	}
+
+	TArray<FShooterTimingWheelEntry> Buckets[LEVEL_COUNT][LEVEL_SIZE];
+
+	/** Scratch arrays reused every tick */
+	TArray<FShooterTimingWheelEntry> Expiring;
+	TArray<FShooterTimingWheelEntry> Cascading;
+
+	float  Resolution;
+	uint64 CurrentTick;
+	int32  NumEntries;
+	bool   bInitialized;
+};
@@ -0,0 +1,102 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "SceneManagement.h"
+
+/**
+* Local view of a world for one frame, owned by AShooterGameState.
+*
+* Built once per frame by AShooterGameState::GetViewContext() (first thing in Tick, or on the first
+* query of the frame made before it) and handed to the pool handlers, so a per object view query is
+* a load and a few multiplies instead of a controller lookup and GetPlayerViewPoint() per object.
+*
+* bHasView is false without a machine client controller (dedicated server, loading), distances
+* are then 0 and everything counts as in the frustum.
+*/
+struct FShooterViewContext
+{
+	/** Machine client controller, NULL when there is no local view */
+	AShooterPlayerController* Controller;
+	bool					  bHasView;
+	/** Eye location and rotation, GetPlayerViewPoint() */
+	FVector					  Location;
+	FRotator				  Rotation;
+	FVector					  Direction;
+	FRotator				  ControlRotation;
+	/** Horizontal field of view in degrees */
+	float					  FOV;
+	FConvexVolume			  Frustum;
+	/** GFrameCounter the context was built on */
+	uint64					  Frame;
+
+	FShooterViewContext()
+		: Controller(NULL)
+		, bHasView(false)
+		, Location(FVector::ZeroVector)
+		, Rotation(FRotator::ZeroRotator)
+		, Direction(FVector::ForwardVector)
+		, ControlRotation(FRotator::ZeroRotator)
+		, FOV(90.0f)
+		, Frame(MAX_uint64)
+	{
+	}
+
+	void Update(UWorld* World)
+	{
+		Frame	   = GFrameCounter;
+		Controller = UShooterStatics::GetMachineClientController(World);
+		bHasView   = Controller != NULL;
+
+		if (!bHasView)
+			return;
+
+		FVector EyeLocation;
+		FRotator EyeRotation;
+		Controller->GetPlayerViewPoint(EyeLocation, EyeRotation);
+
+		FVector2D ViewportSize(1.0f, 1.0f);
+
+		if (World->GetGameViewport())
+		{
+			World->GetGameViewport()->GetViewportSize(ViewportSize);
+		}
+
+		SetView(EyeLocation, EyeRotation, Controller->PlayerCameraManager ? Controller->PlayerCameraManager->GetFOVAngle() : 90.0f, ViewportSize);
+
+		ControlRotation = Controller->GetControlRotation();
+	}
+
+	/** Set the eye and rebuild the frustum, for Update() and for views that have no controller (validation). */
+	void SetView(const FVector& InLocation, const FRotator& InRotation, float InFOV, const FVector2D& ViewportSize)
+	{
+		bHasView  = true;
+		Location  = InLocation;
+		Rotation  = InRotation;
+		Direction = Rotation.Vector();
+		FOV		  = InFOV;
+
+		// Unreal's X forward / Z up to view space, same as the engine's scene views
+		const FMatrix ViewMatrix = FTranslationMatrix(-Location) * FInverseRotationMatrix(Rotation) * FMatrix(
+			FPlane(0, 0, 1, 0),
+			FPlane(1, 0, 0, 0),
+			FPlane(0, 1, 0, 0),
+			FPlane(0, 0, 0, 1));
+
+		const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(FMath::DegreesToRadians(FOV) * 0.5f, FMath::Max(ViewportSize.X, 1.0f), FMath::Max(ViewportSize.Y, 1.0f), GNearClippingPlane);
+
+		GetViewFrustumBounds(Frustum, ViewMatrix * ProjectionMatrix, false);
+	}
+
+	/** @return squared distance of Point to the eye, 0 without a view. */
+	inline float GetDistanceSq(const FVector& Point) const
+	{
+		return bHasView ? FVector::DistSquared(Point, Location) : 0.0f;
+	}
+
+	/** @return whether a sphere around Point can be on screen, always without a view. */
+	inline bool IsInFrustum(const FVector& Point, float Radius) const
+	{
+		return !bHasView || Frustum.IntersectSphere(Point, Radius);
+	}
+};
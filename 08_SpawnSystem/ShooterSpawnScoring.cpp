@@ -0,0 +1,330 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterPlayerStart.h"
+#include "ShooterSpawnScoring.h"
+#include "ShooterPawnGrid.h"
+
+FShooterSpawnScoring::FShooterSpawnScoring()
+	: StepTime(0.5f)
+	, TimeSinceStep(0.0f)
+{
+}
+
+int32 FShooterSpawnScoring::AddSlot(AShooterPlayerStart* Start, const FVector& Location, float CheckRadius, int32 Team, bool bTeamFiltered)
+{
+	const int32 Slot = Starts.Add(Start);
+
+	X.Add(Location.X);
+	Y.Add(Location.Y);
+	Z.Add(Location.Z);
+	CheckRadiiSq.Add(CheckRadius * CheckRadius);
+	Scores.Add(0.0f);
+	RecentSpawnWeights.Add(0.0f);
+	Teams.Add(Team);
+	TeamFiltered.Add(bTeamFiltered);
+
+	return Slot;
+}
+
+void FShooterSpawnScoring::Register(AShooterPlayerStart* Start)
+{
+	check(Start);
+
+	if (Start->SpawnScoring)
+		return;
+
+	const int32 Slot = AddSlot(Start, Start->GetActorLocation(), Start->CheckRadius, Start->GetSpawnPointTeamNum(), Start->IsTeamSpawnPoint());
+
+	// Carry over anything the spawn point collected before it was registered
+	Scores[Slot]			 = Start->SpawnScore;
+	RecentSpawnWeights[Slot] = Start->RecentSpawnWeight;
+
+	Start->SpawnScoring		 = this;
+	Start->SpawnScoringIndex = Slot;
+}
+
+void FShooterSpawnScoring::Unregister(AShooterPlayerStart* Start)
+{
+	check(Start);
+
+	if (Start->SpawnScoring != this)
+		return;
+
+	const int32 Slot = Start->SpawnScoringIndex;
+
+	Start->SpawnScore		 = Scores[Slot];
+	Start->RecentSpawnWeight = RecentSpawnWeights[Slot];
+	Start->SpawnScoring		 = NULL;
+	Start->SpawnScoringIndex = INDEX_NONE;
+
+	Starts.RemoveAtSwap(Slot, 1, false);
+	X.RemoveAtSwap(Slot, 1, false);
+	Y.RemoveAtSwap(Slot, 1, false);
+	Z.RemoveAtSwap(Slot, 1, false);
+	CheckRadiiSq.RemoveAtSwap(Slot, 1, false);
+	Scores.RemoveAtSwap(Slot, 1, false);
+	RecentSpawnWeights.RemoveAtSwap(Slot, 1, false);
+	Teams.RemoveAtSwap(Slot, 1, false);
+	TeamFiltered.RemoveAtSwap(Slot, 1, false);
+
+	// The last spawn point moved into Slot
+	if (Starts.IsValidIndex(Slot) && Starts[Slot])
+	{
+		Starts[Slot]->SpawnScoringIndex = Slot;
+	}
+}
+
+void FShooterSpawnScoring::Empty()
+{
+	for (AShooterPlayerStart* Start : Starts)
+	{
+		if (Start)
+		{
+			Start->SpawnScoring		 = NULL;
+			Start->SpawnScoringIndex = INDEX_NONE;
+		}
+	}
+
+	Starts.Empty();
+	X.Empty();
+	Y.Empty();
+	Z.Empty();
+	CheckRadiiSq.Empty();
+	Scores.Empty();
+	RecentSpawnWeights.Empty();
+	Teams.Empty();
+	TeamFiltered.Empty();
+	Pawns.Reset();
+
+	TimeSinceStep = 0.0f;
+}
+
+void FShooterSpawnScoring::SetScore(int32 Slot, float Value)
+{
+	Scores[Slot] = FMath::Clamp(Value, AShooterPlayerStart::SCORE_SPAWN_MIN, AShooterPlayerStart::SCORE_SPAWN_MAX);
+}
+
+void FShooterSpawnScoring::AddScore(int32 Slot, float Value)
+{
+	SetScore(Slot, Scores[Slot] + Value);
+}
+
+void FShooterSpawnScoring::Spawned(int32 Slot)
+{
+	RecentSpawnWeights[Slot] = AShooterPlayerStart::SCORE_RECENT_SPAWN_MAX;
+}
+
+void FShooterSpawnScoring::AffectNearSpawnPoints(int32 Slot)
+{
+	const float NearbyDistSq = AShooterPlayerStart::SCORE_NEARBY_DIST * AShooterPlayerStart::SCORE_NEARBY_DIST;
+	const float Bonus		 = AShooterPlayerStart::SCORE_RECENT_SPAWN_MAX * 1.5f;
+
+	const float SX	  = X[Slot];
+	const float SY	  = Y[Slot];
+	const float SZ	  = Z[Slot];
+	const int32 Count = Starts.Num();
+
+	for (int32 Other = 0; Other < Count; Other++)
+	{
+		const float DX = X[Other] - SX;
+		const float DY = Y[Other] - SY;
+		const float DZ = Z[Other] - SZ;
+
+		if (DX * DX + DY * DY + DZ * DZ < NearbyDistSq)
+		{
+			AddScore(Other, Bonus);
+		}
+	}
+}
+
+void FShooterSpawnScoring::GatherPawns(const FShooterPawnGrid& PawnGrid)
+{
+	Pawns.Reset();
+
+	const int32 Count = PawnGrid.Num();
+
+	for (int32 Slot = 0; Slot < Count; Slot++)
+	{
+		AShooterCharacter* Pawn = PawnGrid.GetPawn(Slot);
+
+		if (Pawn->IsPendingKill())
+			continue;
+
+		AShooterPlayerState* PawnState = Cast<AShooterPlayerState>(Pawn->PlayerState);
+
+		Pawns.Add(Pawn->GetActorLocation(),
+				  Pawn->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() * 4.0f,
+				  Pawn->GetControlRotation().Vector().GetSafeNormal(),
+				  PawnState ? PawnState->GetTeamNum() : int32(FShooterSpawnScoringPawns::NO_PLAYER_STATE));
+	}
+}
+
+void FShooterSpawnScoring::Tick(float DeltaSeconds, const FShooterPawnGrid& PawnGrid)
+{
+	TimeSinceStep += DeltaSeconds;
+
+	if (TimeSinceStep < StepTime)
+		return;
+
+	TimeSinceStep = 0.0f;
+
+	// Team sides can change between rounds
+	const int32 Count = Starts.Num();
+
+	for (int32 Slot = 0; Slot < Count; Slot++)
+	{
+		Teams[Slot] = Starts[Slot]->GetSpawnPointTeamNum();
+	}
+
+	GatherPawns(PawnGrid);
+	Step(Pawns);
+}
+
+void FShooterSpawnScoring::Step(const FShooterSpawnScoringPawns& InPawns)
+{
+	const float SearchRange		  = AShooterPlayerStart::SCORE_SEARCH_RANGE;
+	const float DotProductMult	  = AShooterPlayerStart::SCORE_DOTPRODUCT_MULT;
+	const float RegenRate		  = AShooterPlayerStart::SCORE_REGEN_RATE;
+	const float RecentSpawnMax	  = AShooterPlayerStart::SCORE_RECENT_SPAWN_MAX;
+	const float RecentSpawnDecr	  = AShooterPlayerStart::SCORE_RECENT_SPAWN_DECREASE;
+	const float ScoreMin		  = AShooterPlayerStart::SCORE_SPAWN_MIN;
+	const float ScoreMax		  = AShooterPlayerStart::SCORE_SPAWN_MAX;
+	const float FOV				  = AShooterPlayerStart::SCORE_FOV;
+
+	const int32 StartCount = Starts.Num();
+	const int32 PawnCount  = InPawns.Num();
+
+	const float* PX = InPawns.X.GetData();
+	const float* PY = InPawns.Y.GetData();
+	const float* PZ = InPawns.Z.GetData();
+	const float* PH = InPawns.TestHeights.GetData();
+	const float* VX = InPawns.ViewX.GetData();
+	const float* VY = InPawns.ViewY.GetData();
+	const float* VZ = InPawns.ViewZ.GetData();
+	const int32* PT = InPawns.Teams.GetData();
+
+	for (int32 Slot = 0; Slot < StartCount; Slot++)
+	{
+		float Score = Scores[Slot];
+
+		// Recently used spawn points lose score while the weight decays
+		float RecentSpawnWeight = RecentSpawnWeights[Slot];
+
+		if (RecentSpawnWeight > 0.0f)
+		{
+			RecentSpawnWeight		 = FMath::Clamp(RecentSpawnWeight - RecentSpawnDecr, 0.0f, RecentSpawnMax);
+			RecentSpawnWeights[Slot] = RecentSpawnWeight;
+
+			Score = FMath::Clamp(Score - RecentSpawnWeight, ScoreMin, ScoreMax);
+		}
+
+		const float SX		 = X[Slot];
+		const float SY		 = Y[Slot];
+		const float SZ		 = Z[Slot];
+		const float RadiusSq = CheckRadiiSq[Slot];
+		const int32 Team	 = Teams[Slot];
+
+		// Team spawn points only count pawns of the other team, one without a team never stops regenerating
+		const int32 bCountAll  = !TeamFiltered[Slot];
+		const int32 bCanBlock  = bCountAll | (Team != INDEX_NONE);
+
+		float Penalty  = 0.0f;
+		int32 NearBy   = 0;
+		int32 Blocking = 0;
+#if !UE_BUILD_SHIPPING
+		int32 Visible  = 0;
+#endif
+
+		// Branch free over the pawn arrays so the compiler can vectorise it
+		for (int32 Pawn = 0; Pawn < PawnCount; Pawn++)
+		{
+			const float DX = PX[Pawn] - SX;
+			const float DY = PY[Pawn] - SY;
+			const float DZ = PZ[Pawn] - SZ;
+
+			const int32 bNear	 = (DX * DX + DY * DY < RadiusSq) & (FMath::Abs(DZ) < PH[Pawn]);
+			const int32 bCounted = bNear & (bCountAll | ((PT[Pawn] != FShooterSpawnScoringPawns::NO_PLAYER_STATE) & (PT[Pawn] != Team)));
+
+			// Pawn looking away from the spawn point (dot of view and spawn point -> pawn direction below SCORE_FOV)
+			const float LengthSq   = DX * DX + DY * DY + DZ * DZ;
+			const float InvLength  = LengthSq > SMALL_NUMBER ? FMath::InvSqrt(LengthSq) : 0.0f;
+			const int32 bLookAway  = (VX[Pawn] * DX + VY[Pawn] * DY + VZ[Pawn] * DZ) * InvLength < FOV;
+
+			Penalty	 += bCounted * (SearchRange + bLookAway * DotProductMult);
+			NearBy	 += bCounted;
+			Blocking += bCounted & bCanBlock;
+#if !UE_BUILD_SHIPPING
+			Visible	 += bCounted & bLookAway;
+#endif
+		}
+
+		// Every near by pawn clamps to the same range, clamping the sum once gives the same score
+		if (NearBy > 0)
+		{
+			Score = FMath::Clamp(Score - Penalty, ScoreMin, ScoreMax);
+		}
+
+		// No pawn near by, the spawn point regenerates
+		if (Blocking == 0)
+		{
+			Score = FMath::Clamp(Score + RegenRate, ScoreMin, ScoreMax);
+		}
+
+		Scores[Slot] = Score;
+
+#if !UE_BUILD_SHIPPING
+		if (Starts[Slot])
+		{
+			Starts[Slot]->bRayHit = Visible > 0; // for debug dot product
+		}
+#endif
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+void FShooterSpawnScoring::RunBenchmark()
+{
+	const int32 PawnCount	  = 32;
+	const int32 StartCounts[] = { 64, 256, 1024 };
+	const int32 Iterations	  = 200;
+
+	FRandomStream Random(0x5eed);
+
+	FShooterSpawnScoringPawns BenchPawns;
+
+	for (int32 Pawn = 0; Pawn < PawnCount; Pawn++)
+	{
+		const FVector Location(Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(0.0f, 1000.0f));
+		BenchPawns.Add(Location, 88.0f * 4.0f, Random.GetUnitVector(), Pawn % 2);
+	}
+
+	for (int32 StartCount : StartCounts)
+	{
+		FShooterSpawnScoring Scoring;
+
+		for (int32 Slot = 0; Slot < StartCount; Slot++)
+		{
+			const FVector Location(Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(0.0f, 1000.0f));
+			Scoring.AddSlot(NULL, Location, 3000.0f, Slot % 3 - 1, (Slot & 1) != 0);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Scoring.Step(BenchPawns);
+		}
+
+		const double StepMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+		UE_LOG(LogShooter, Log, TEXT("SpawnScoring benchmark: %4d spawn points x %d pawns, %.4f ms per step"), StartCount, PawnCount, StepMs);
+	}
+}
+
+static FAutoConsoleCommand SpawnScoringBenchmarkCommand(
+	TEXT("shooter.benchmarkspawnscoring"),
+	TEXT("Time a spawn scoring step at 64, 256 and 1024 spawn points against 32 pawns."),
+	FConsoleCommandDelegate::CreateStatic(&FShooterSpawnScoring::RunBenchmark)
+	);
+#endif // #if !UE_BUILD_SHIPPING
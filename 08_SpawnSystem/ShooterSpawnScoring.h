@@ -0,0 +1,131 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class AShooterPlayerStart;
+class FShooterPawnGrid;
+
+/** Per pawn data a scoring step reads, gathered once per step (SoA). */
+struct FShooterSpawnScoringPawns
+{
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+	/** Height band a pawn blocks a spawn point in, 4 capsule half heights */
+	TArray<float> TestHeights;
+	/** Normalized control rotation */
+	TArray<float> ViewX;
+	TArray<float> ViewY;
+	TArray<float> ViewZ;
+	/** Team number, NO_PLAYER_STATE when the pawn has no player state */
+	TArray<int32> Teams;
+
+	enum { NO_PLAYER_STATE = -2 };
+
+	void Reset()
+	{
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+		TestHeights.Reset();
+		ViewX.Reset();
+		ViewY.Reset();
+		ViewZ.Reset();
+		Teams.Reset();
+	}
+
+	void Add(const FVector& Location, float TestHeight, const FVector& View, int32 Team)
+	{
+		X.Add(Location.X);
+		Y.Add(Location.Y);
+		Z.Add(Location.Z);
+		TestHeights.Add(TestHeight);
+		ViewX.Add(View.X);
+		ViewY.Add(View.Y);
+		ViewZ.Add(View.Z);
+		Teams.Add(Team);
+	}
+
+	inline int32 Num() const
+	{
+		return X.Num();
+	}
+};
+
+/**
+* Spawn scores of every AShooterPlayerStart of the world, owned by AShooterGameState (server only).
+*
+* Spawn points register when the game mode adds them and keep no timer of their own. Their
+* location, check radius, team, SpawnScore and RecentSpawnWeight live in contiguous arrays
+* indexed by scoring slot. Every StepTime the pawns are gathered once and Step() scores all
+* spawn points against all pawns in one pass:
+*   - recent spawn weight decays and is taken off the score,
+*   - every pawn near by (XY radius plus 4 capsule half heights on Z) takes SCORE_SEARCH_RANGE,
+*     plus SCORE_DOTPRODUCT_MULT when it is looking away from the spawn point,
+*   - a spawn point no pawn is near by regenerates SCORE_REGEN_RATE.
+* Team spawn points (TDM) only count pawns of the other team, a team spawn point without a team
+* counts every pawn with a player state and always regenerates.
+*/
+class FShooterSpawnScoring
+{
+public:
+	FShooterSpawnScoring();
+
+	void Register(AShooterPlayerStart* Start);
+	void Unregister(AShooterPlayerStart* Start);
+	void Empty();
+
+	inline int32 Num() const
+	{
+		return Starts.Num();
+	}
+
+	/** Run a Step() every StepTime seconds. */
+	void Tick(float DeltaSeconds, const FShooterPawnGrid& PawnGrid);
+
+	/** Score every spawn point against Pawns. */
+	void Step(const FShooterSpawnScoringPawns& Pawns);
+
+	inline float GetScore(int32 Slot) const
+	{
+		return Scores[Slot];
+	}
+
+	void SetScore(int32 Slot, float Value);
+	void AddScore(int32 Slot, float Value);
+
+	/** Spawn point in Slot was just used. */
+	void Spawned(int32 Slot);
+
+	/** Raise the score of every spawn point within SCORE_NEARBY_DIST of Slot. */
+	void AffectNearSpawnPoints(int32 Slot);
+
+#if !UE_BUILD_SHIPPING
+	/** Time Step() on synthetic data, 64 / 256 / 1024 spawn points against 32 pawns. */
+	static void RunBenchmark();
+#endif // #if !UE_BUILD_SHIPPING
+
+	/** Seconds between steps, the old per spawn point CheckTimeStep */
+	float StepTime;
+
+private:
+	int32 AddSlot(AShooterPlayerStart* Start, const FVector& Location, float CheckRadius, int32 Team, bool bTeamFiltered);
+
+	void GatherPawns(const FShooterPawnGrid& PawnGrid);
+
+	TArray<AShooterPlayerStart*> Starts;
+	TArray<float>				 X;
+	TArray<float>				 Y;
+	TArray<float>				 Z;
+	TArray<float>				 CheckRadiiSq;
+	TArray<float>				 Scores;
+	TArray<float>				 RecentSpawnWeights;
+	/** Spawn point team, INDEX_NONE for no team */
+	TArray<int32>				 Teams;
+	/** Spawn point only counts pawns of the other team (TDM) */
+	TArray<uint8>				 TeamFiltered;
+
+	FShooterSpawnScoringPawns	 Pawns;
+
+	float						 TimeSinceStep;
+};